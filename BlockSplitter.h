@@ -0,0 +1,150 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+
+#include "ParameterEventQueue.h"
+
+namespace moiraesoftware {
+
+    // What a BlockSplitter hands to the processing callback for each sub-block
+    template <std::size_t NumParameters>
+    struct SubBlockParameters {
+        int                               startSample = 0;       // within the block passed to process()
+        const float*                      values      = nullptr; // plain values, one per parameter
+        ParameterDirtyBits<NumParameters> changed;               // applied at the start of this sub-block
+
+        [[nodiscard]] float operator[] (std::size_t index) const noexcept {
+            jassert (index < NumParameters);
+            return values[index];
+        }
+    };
+
+    /*
+    Splits processBlock at the sample offsets of the parameter changes in a ParameterEventQueue, so each stretch
+    of audio is processed with the values that were current for it:
+
+        BlockSplitter<numParams> splitter;                          // processor member, next to the queue
+        ...
+        void prepareToPlay (double, int) override {
+            splitter.setMinimumSubBlockSize (32);
+            for (std::size_t i = 0; i < numParams; ++i)
+                splitter.setValue (i, handles.get (i));
+        }
+
+        void processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer&) override {
+            juce::dsp::AudioBlock<float> block (buffer);
+            splitter.process (queue, block, [&] (juce::dsp::AudioBlock<float>& subBlock, const auto& parameters) {
+                if (parameters.changed.test (cutoffIndex))
+                    filter.setCutoff (parameters[cutoffIndex]);
+                filter.process (juce::dsp::ProcessContextReplacing<float> (subBlock));
+            });
+        }
+
+    A sub-block starts at an event's offset only if the previous one is at least getMinimumSubBlockSize()
+    samples long; otherwise the event is applied at the earliest boundary that is, which may be the start of the
+    next block. Changes are never applied early and at most minimum - 1 samples late, and only the last
+    sub-block of a block may be shorter. Events at the same offset share a boundary, and a block without events
+    is one callback for the whole block.
+
+    Audio thread only, apart from construction. The events for a block are stored in a fixed array sized for
+    everything one drain() can deliver, so process() never allocates.
+    */
+    template <std::size_t NumParameters, std::size_t Capacity = 256>
+    class BlockSplitter {
+    public:
+        using Queue = ParameterEventQueue<NumParameters, Capacity>;
+
+        BlockSplitter() = default;
+
+        // Values until the first event, e.g. from ParameterHandleCache in prepareToPlay
+        void setValue (std::size_t index, float value) noexcept {
+            jassert (index < NumParameters);
+            values[index] = value;
+        }
+
+        [[nodiscard]] float getValue (std::size_t index) const noexcept {
+            jassert (index < NumParameters);
+            return values[index];
+        }
+
+        // Bounds the per-callback overhead: at most numSamples / minimum + 1 callbacks per block
+        void setMinimumSubBlockSize (int numSamples) noexcept {
+            jassert (numSamples > 0);
+            minimumSubBlockSize = std::max (1, numSamples);
+        }
+
+        [[nodiscard]] int getMinimumSubBlockSize() const noexcept { return minimumSubBlockSize; }
+
+        // Together with the queue's reset(), e.g. from prepareToPlay. Drops changes carried over from the last block.
+        void reset() noexcept { carriedOver = {}; }
+
+        // Drains queue for this block and calls fn (juce::dsp::AudioBlock<SampleType>&, const SubBlockParameters&)
+        // once per sub-block, in order. Returns the number of sub-blocks.
+        template <typename SampleType, typename Fn>
+        int process (Queue& queue, juce::dsp::AudioBlock<SampleType>& block, juce::int64 blockStartTicks, Fn&& fn) noexcept {
+            const auto numSamples = static_cast<int> (block.getNumSamples());
+            if (numSamples == 0)
+                return 0;
+
+            numEvents = 0;
+            queue.drain (numSamples, blockStartTicks, [this] (const ParameterEvent& event) {
+                jassert (numEvents < events.size());
+                events[numEvents++] = event;
+            });
+
+            return split (block, numSamples, std::forward<Fn> (fn));
+        }
+
+        template <typename SampleType, typename Fn>
+        int process (Queue& queue, juce::dsp::AudioBlock<SampleType>& block, Fn&& fn) noexcept {
+            return process (queue, block, juce::Time::getHighResolutionTicks(), std::forward<Fn> (fn));
+        }
+
+    private:
+        template <typename SampleType, typename Fn>
+        int split (juce::dsp::AudioBlock<SampleType>& block, int numSamples, Fn&& fn) {
+            // drain() delivers offsets in non-decreasing order, so one pass over the events is enough
+            std::size_t next         = 0;
+            int         start        = 0;
+            int         numSubBlocks = 0;
+
+            while (start < numSamples) {
+                SubBlockParameters<NumParameters> parameters { start, values.data(), std::exchange (carriedOver, {}) };
+
+                for (; next < numEvents && events[next].sampleOffset <= start; ++next)
+                    apply (events[next], parameters.changed);
+
+                auto end = numSamples;
+                if (next < numEvents)
+                    end = std::min (numSamples, std::max (events[next].sampleOffset, start + minimumSubBlockSize));
+
+                auto subBlock = block.getSubBlock (static_cast<std::size_t> (start), static_cast<std::size_t> (end - start));
+                fn (subBlock, std::as_const (parameters));
+
+                ++numSubBlocks;
+                start = end;
+            }
+
+            // Events too close to the end for another sub-block take effect at the start of the next block
+            for (; next < numEvents; ++next)
+                apply (events[next], carriedOver);
+
+            return numSubBlocks;
+        }
+
+        void apply (const ParameterEvent& event, ParameterDirtyBits<NumParameters>& changed) noexcept {
+            values[event.index] = event.value;
+            changed.words[event.index / 64] |= std::uint64_t { 1 } << (event.index % 64);
+        }
+
+        std::array<float, NumParameters>  values {};
+        ParameterDirtyBits<NumParameters> carriedOver;
+        int                               minimumSubBlockSize = 32;
+
+        // Everything one drain() can deliver: a full ring plus one coalesced value per parameter
+        std::array<ParameterEvent, Capacity + NumParameters> events {};
+        std::size_t                                          numEvents = 0;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BlockSplitter)
+    };
+}
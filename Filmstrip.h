@@ -0,0 +1,261 @@
+#pragma once
+
+#include "UIHelpers.h"
+#include "FilmstripAtlas.h"
+
+#include <map>
+#include <tuple>
+
+namespace moiraesoftware {
+
+    // A mosaic of equally sized frames, sliced by extractTileByNumber. numFrames 0 means every tile in the image.
+    // Strips from a packed atlas come from fromAtlas() and are looked up in the atlas table instead.
+    struct FilmstripSpec {
+        juce::Image       mosaic;
+        int               tileWidth   = 0;
+        int               tileHeight  = 0;
+        int               numFrames   = 0;
+        const AtlasFrame* atlasFrames = nullptr;
+
+        static FilmstripSpec fromAtlas (const AtlasTable& table, int strip) {
+            const auto& s = table.getStrip (strip);
+            return { getAtlasImage (table), s.tileWidth, s.tileHeight, s.numFrames, table.frames + s.firstFrame };
+        }
+
+        template <typename StripEnum, typename = std::enable_if_t<std::is_enum_v<StripEnum>>>
+        static FilmstripSpec fromAtlas (const AtlasTable& table, StripEnum strip) {
+            return fromAtlas (table, static_cast<int> (strip));
+        }
+
+        [[nodiscard]] int getNumTiles() const {
+            if (atlasFrames != nullptr)
+                return numFrames;
+
+            const auto tilesInMosaic = (mosaic.getWidth() / tileWidth) * (mosaic.getHeight() / tileHeight);
+            return numFrames > 0 ? juce::jmin (numFrames, tilesInMosaic) : tilesInMosaic;
+        }
+
+        [[nodiscard]] juce::Rectangle<int> getTile (int n) const {
+            return atlasFrames != nullptr ? atlasFrames[n].toRectangle() : extractTileByNumber (mosaic, tileWidth, tileHeight, n);
+        }
+    };
+
+    /*
+    Every frame of a filmstrip, sliced out of the mosaic and resampled to the size it is drawn at, once.
+    Painting a frame is then a single blit of an image that already has the right pixel dimensions, with no
+    rectangle arithmetic, clipping or scaling per paint.
+
+    Caches are shared between components through get(), keyed by mosaic and target size, so a bank of identical
+    knobs slices the mosaic once. Message thread only.
+    */
+    class FilmstripTileCache {
+    public:
+        FilmstripTileCache (const FilmstripSpec& spec, int frameWidthIn, int frameHeightIn) :
+            frameWidth (frameWidthIn), frameHeight (frameHeightIn) {
+            jassert (spec.mosaic.isValid() && spec.tileWidth > 0 && spec.tileHeight > 0);
+            jassert (frameWidth > 0 && frameHeight > 0);
+
+            const auto numFrames    = spec.getNumTiles();
+            const auto needsScaling = frameWidth != spec.tileWidth || frameHeight != spec.tileHeight;
+
+            frames.reserve (static_cast<std::size_t> (juce::jmax (0, numFrames)));
+
+            for (int n = 0; n < numFrames; ++n) {
+                const auto  tile = spec.getTile (n);
+                juce::Image frame (juce::Image::ARGB, frameWidth, frameHeight, true);
+                {
+                    juce::Graphics g (frame);
+                    g.setImageResamplingQuality (juce::Graphics::highResamplingQuality);
+                    if (needsScaling)
+                        g.drawImage (spec.mosaic, 0, 0, frameWidth, frameHeight, tile.getX(), tile.getY(), tile.getWidth(), tile.getHeight());
+                    else
+                        g.drawImageAt (spec.mosaic, -tile.getX(), -tile.getY());
+                }
+                frames.push_back (std::move (frame));
+            }
+        }
+
+        // Shared cache for this mosaic at this size, built on first use and released with its last user
+        static std::shared_ptr<const FilmstripTileCache> get (const FilmstripSpec& spec, int frameWidth, int frameHeight) {
+            JUCE_ASSERT_MESSAGE_THREAD
+
+            static std::map<Key, std::weak_ptr<const FilmstripTileCache>> caches;
+
+            const Key key { spec.mosaic.getPixelData(), spec.atlasFrames, spec.tileWidth, spec.tileHeight, spec.numFrames, frameWidth, frameHeight };
+
+            if (auto existing = caches[key].lock())
+                return existing;
+
+            // Drop entries whose last user has gone before adding another
+            for (auto it = caches.begin(); it != caches.end();)
+                it = it->second.expired() ? caches.erase (it) : std::next (it);
+
+            auto cache   = std::make_shared<const FilmstripTileCache> (spec, frameWidth, frameHeight);
+            caches[key]  = cache;
+            return cache;
+        }
+
+        [[nodiscard]] int getNumFrames() const noexcept { return static_cast<int> (frames.size()); }
+        [[nodiscard]] int getFrameWidth() const noexcept { return frameWidth; }
+        [[nodiscard]] int getFrameHeight() const noexcept { return frameHeight; }
+
+        [[nodiscard]] const juce::Image& getFrame (int index) const noexcept {
+            jassert (!frames.empty());
+            return frames[static_cast<std::size_t> (juce::jlimit (0, getNumFrames() - 1, index))];
+        }
+
+        // Frame for a position 0..1 along the strip
+        [[nodiscard]] const juce::Image& getFrameForProportion (double proportion) const noexcept {
+            return getFrame (juce::roundToInt (juce::jlimit (0.0, 1.0, proportion) * (getNumFrames() - 1)));
+        }
+
+    private:
+        // Identifies the mosaic by its pixel data. Every painter keeps its mosaic alive, so the data outlives the
+        // caches built from it and an address is not reused while its entry is live.
+        using Key = std::tuple<const void*, const AtlasFrame*, int, int, int, int, int>;
+
+        int                      frameWidth;
+        int                      frameHeight;
+        std::vector<juce::Image> frames;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FilmstripTileCache)
+    };
+
+    // Works out where a filmstrip frame goes in a component and fetches the cache at that component's physical
+    // pixel size, so paint can blit without resampling. Call update() from resized().
+    class FilmstripPainter {
+    public:
+        explicit FilmstripPainter (FilmstripSpec specIn) : spec (std::move (specIn)) {}
+
+        void update (juce::Component& component) {
+            const auto placed = juce::RectanglePlacement (juce::RectanglePlacement::centred)
+                                    .appliedTo (juce::Rectangle<float> (0.0f, 0.0f, static_cast<float> (spec.tileWidth), static_cast<float> (spec.tileHeight)),
+                                                component.getLocalBounds().toFloat());
+            const auto scale = juce::Component::getApproximateScaleFactorForComponent (&component);
+            const auto pixelWidth  = juce::roundToInt (placed.getWidth() * scale);
+            const auto pixelHeight = juce::roundToInt (placed.getHeight() * scale);
+
+            if (pixelWidth <= 0 || pixelHeight <= 0) {
+                tiles.reset();
+                return;
+            }
+
+            if (tiles == nullptr || tiles->getFrameWidth() != pixelWidth || tiles->getFrameHeight() != pixelHeight)
+                tiles = FilmstripTileCache::get (spec, pixelWidth, pixelHeight);
+
+            // Undoes the display scale, so the frame lands on the screen pixel for pixel
+            drawTransform = juce::AffineTransform::scale (1.0f / scale).translated (placed.getX(), placed.getY());
+        }
+
+        void paint (juce::Graphics& g, int frameIndex) const {
+            if (tiles != nullptr)
+                g.drawImageTransformed (tiles->getFrame (frameIndex), drawTransform);
+        }
+
+        void paintProportion (juce::Graphics& g, double proportion) const {
+            if (tiles != nullptr)
+                g.drawImageTransformed (tiles->getFrameForProportion (proportion), drawTransform);
+        }
+
+        [[nodiscard]] int getNumFrames() const noexcept { return tiles != nullptr ? tiles->getNumFrames() : 0; }
+
+    private:
+        FilmstripSpec                             spec;
+        std::shared_ptr<const FilmstripTileCache> tiles;
+        juce::AffineTransform                     drawTransform;
+    };
+
+    // A slider drawn from a filmstrip, first frame at the minimum and last at the maximum
+    class FilmstripSlider : public juce::Slider {
+    public:
+        explicit FilmstripSlider (FilmstripSpec spec, SliderStyle style = RotaryVerticalDrag) :
+            juce::Slider (style, NoTextBox), painter (std::move (spec)) {}
+
+        void paint (juce::Graphics& g) override { painter.paintProportion (g, valueToProportionOfLength (getValue())); }
+
+        void resized() override {
+            juce::Slider::resized();
+            painter.update (*this);
+        }
+
+    private:
+        FilmstripPainter painter;
+    };
+
+    // A toggle drawn from a filmstrip: frames are off, on, and optionally off and on while the mouse is over it
+    class FilmstripButton : public juce::Button {
+    public:
+        explicit FilmstripButton (FilmstripSpec spec, const juce::String& name = {}) :
+            juce::Button (name), painter (std::move (spec)) {
+            setClickingTogglesState (true);
+        }
+
+        void paintButton (juce::Graphics& g, bool shouldDrawButtonAsHighlighted, bool) override {
+            const auto highlighted = shouldDrawButtonAsHighlighted && painter.getNumFrames() >= 4;
+            painter.paint (g, (getToggleState() ? 1 : 0) + (highlighted ? 2 : 0));
+        }
+
+        void resized() override { painter.update (*this); }
+
+    private:
+        FilmstripPainter painter;
+    };
+
+    class AttachedFilmstripSlider : public ComponentWithParamMenu {
+    public:
+        AttachedFilmstripSlider (juce::AudioProcessorEditor& editorIn,
+                                 juce::RangedAudioParameter& paramIn,
+                                 juce::UndoManager*          undoManager,
+                                 FilmstripSpec               spec,
+                                 ParameterUpdateDispatcher*  dispatcher = nullptr) :
+            ComponentWithParamMenu (editorIn, paramIn), slider (std::move (spec)) {
+            if (dispatcher != nullptr)
+                batchedAttachment.emplace (*dispatcher, paramIn, slider, undoManager);
+            else
+                attachment.emplace (paramIn, slider, undoManager);
+
+            slider.addMouseListener (this, true);
+            addAndMakeVisible (slider);
+        }
+
+        void resized() override { slider.setBounds (getLocalBounds()); }
+
+        FilmstripSlider& getSlider() { return slider; }
+
+    private:
+        FilmstripSlider                                 slider;
+        std::optional<juce::SliderParameterAttachment>  attachment;
+        std::optional<BatchedSliderParameterAttachment> batchedAttachment;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AttachedFilmstripSlider)
+    };
+
+    class AttachedFilmstripButton : public ComponentWithParamMenu {
+    public:
+        AttachedFilmstripButton (juce::AudioProcessorEditor& editorIn,
+                                 juce::RangedAudioParameter& paramIn,
+                                 juce::UndoManager*          undoManager,
+                                 FilmstripSpec               spec,
+                                 ParameterUpdateDispatcher*  dispatcher = nullptr) :
+            ComponentWithParamMenu (editorIn, paramIn), button (std::move (spec), paramIn.name) {
+            if (dispatcher != nullptr)
+                batchedAttachment.emplace (*dispatcher, paramIn, button, undoManager);
+            else
+                attachment.emplace (paramIn, button, undoManager);
+
+            button.addMouseListener (this, true);
+            addAndMakeVisible (button);
+        }
+
+        void resized() override { button.setBounds (getLocalBounds()); }
+
+        FilmstripButton& getButton() { return button; }
+
+    private:
+        FilmstripButton                                 button;
+        std::optional<juce::ButtonParameterAttachment>  attachment;
+        std::optional<BatchedButtonParameterAttachment> batchedAttachment;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AttachedFilmstripButton)
+    };
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+namespace moiraesoftware {
+
+    // Where one frame sits in a packed atlas
+    struct AtlasFrame {
+        int x = 0, y = 0, width = 0, height = 0;
+
+        [[nodiscard]] constexpr juce::Rectangle<int> toRectangle() const noexcept { return { x, y, width, height }; }
+    };
+
+    // One filmstrip inside an atlas: its frames are frames[firstFrame, firstFrame + numFrames)
+    struct AtlasStrip {
+        std::string_view name;
+        int              firstFrame = 0;
+        int              numFrames  = 0;
+        int              tileWidth  = 0;
+        int              tileHeight = 0;
+    };
+
+    /*
+    The table parameter_helpers_add_filmstrip_atlas() generates: the packed atlas as PNG bytes, plus where every
+    frame of every strip ended up. Looking a frame up replaces the uniform-grid arithmetic of extractTileByNumber
+    with an index into a constexpr array, and strips of any size can share one image.
+    */
+    struct AtlasTable {
+        const unsigned char* png       = nullptr;
+        std::size_t          pngSize   = 0;
+        const AtlasStrip*    strips    = nullptr;
+        std::size_t          numStrips = 0;
+        const AtlasFrame*    frames    = nullptr;
+        std::size_t          numFrames = 0;
+
+        [[nodiscard]] constexpr const AtlasStrip& getStrip (int strip) const noexcept {
+            jassert (strip >= 0 && static_cast<std::size_t> (strip) < numStrips);
+            return strips[strip];
+        }
+
+        // -1 if there is no strip with this name
+        [[nodiscard]] constexpr int findStrip (std::string_view name) const noexcept {
+            for (std::size_t i = 0; i < numStrips; ++i)
+                if (strips[i].name == name)
+                    return static_cast<int> (i);
+            return -1;
+        }
+
+        [[nodiscard]] constexpr juce::Rectangle<int> getTile (int strip, int frame) const noexcept {
+            const auto& s = getStrip (strip);
+            jassert (frame >= 0 && frame < s.numFrames);
+            return frames[s.firstFrame + frame].toRectangle();
+        }
+    };
+
+    // The atlas image, decoded on first use and then shared by every editor in the process through juce::ImageCache
+    inline juce::Image getAtlasImage (const AtlasTable& table) {
+        return juce::ImageCache::getFromMemory (table.png, static_cast<int> (table.pngSize));
+    }
+
+    // Counterpart of extractTileByNumber for a packed atlas
+    inline juce::Rectangle<int> extractTileFromAtlas (const AtlasTable& table, int strip, int n) {
+        return table.getTile (strip, n);
+    }
+}
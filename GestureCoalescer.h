@@ -0,0 +1,82 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include "ParameterUpdateDispatcher.h"
+
+namespace moiraesoftware {
+
+    // Passed to UndoManager::setMaxNumberOfStoredUnits, the defaults are JUCE's own
+    struct UndoHistoryLimits {
+        int maxUnitsToKeep        = 30000;
+        int minTransactionsToKeep = 30;
+    };
+
+    /*
+    Merges rapid discrete edits of one parameter, e.g. clicking through a cycler or stepping radio buttons with
+    the scroll wheel, into a single undo transaction and a single begin/end gesture pair for the host.
+
+    The first edit opens a gesture, every edit of the same parameter within windowMs of the previous one joins
+    it, and the gesture is closed once the parameter has been left alone for windowMs. An edit of a different
+    parameter closes the open gesture first, so one coalescer can be shared by every control in an editor:
+
+        GestureCoalescer coalescer { undoManager, 400, { 5000, 20 } };
+        cycler.setGestureCoalescer (&coalescer);
+        radioButtons.getAttachment().setGestureCoalescer (&coalescer);
+
+    The overload taking an UndoManager also bounds its history, as each coalesced run is a transaction of its own.
+    Controls stop using the coalescer in their destructor, which closes any gesture they left open. The
+    coalescer must outlive the controls given to it. Message thread only.
+    */
+    class GestureCoalescer : private juce::Timer {
+    public:
+        explicit GestureCoalescer (int windowMsIn = 400) : windowMs (windowMsIn) {}
+
+        GestureCoalescer (juce::UndoManager& undoManager, int windowMsIn, UndoHistoryLimits limits = {}) :
+            windowMs (windowMsIn) {
+            undoManager.setMaxNumberOfStoredUnits (limits.maxUnitsToKeep, limits.minTransactionsToKeep);
+        }
+
+        ~GestureCoalescer() override { flush(); }
+
+        // Use in place of attachment.setValueAsCompleteGesture (newDenormalisedValue)
+        void setValue (OptionallyBatchedParameterAttachment& attachment, float newDenormalisedValue) {
+            JUCE_ASSERT_MESSAGE_THREAD
+
+            if (open != &attachment) {
+                flush();
+                open = &attachment;
+                attachment.beginGesture();
+            }
+
+            attachment.setValueAsPartOfGesture (newDenormalisedValue);
+            startTimer (windowMs);
+        }
+
+        // Closes the open gesture now, e.g. before saving a preset or when the editor loses focus
+        void flush() {
+            stopTimer();
+            if (auto* attachment = std::exchange (open, nullptr))
+                attachment->endGesture();
+        }
+
+        // Called by a control that is going away
+        void release (OptionallyBatchedParameterAttachment& attachment) {
+            if (open == &attachment)
+                flush();
+        }
+
+        [[nodiscard]] bool isGestureOpen() const noexcept { return open != nullptr; }
+
+        void setWindowMs (int newWindowMs) noexcept { windowMs = newWindowMs; }
+        [[nodiscard]] int getWindowMs() const noexcept { return windowMs; }
+
+    private:
+        void timerCallback() override { flush(); }
+
+        int                                   windowMs;
+        OptionallyBatchedParameterAttachment* open = nullptr;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (GestureCoalescer)
+    };
+}
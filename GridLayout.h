@@ -0,0 +1,183 @@
+#pragma once
+
+#include "UIHelpers.h"
+
+namespace moiraesoftware {
+
+    /*
+    A juce::Grid that is built once and remembers its results. Item rectangles are cached per bounds size, so
+    dragging a window back and forth over sizes it has already seen only moves components, and laying out at
+    the same bounds again costs nothing unless the layout was changed. A nested layout added as an item is
+    laid out in its cell and keeps its own cache, so a change inside it recomputes that subtree only.
+
+        CachedGridLayout layout;
+        layout.getGrid().templateColumns = { Fr (1), Fr (2), Px (120) };
+        layout.add (cutoffSlider);
+        layout.add (modeCombo, juce::GridItem().withArea (2, 1, 3, 4));
+        layout.add (envelopeSection);                    // another CachedGridLayout
+        ...
+        void resized() override { layout.performLayout (getLocalBounds()); }
+
+    With setTrackSource (TrackSource::columnsFromItems) or rowsFromItems, one track is made per item from
+    TrackInfoTraitsFor the item's type, Fr (1) for types without traits, instead of from templateColumns or
+    templateRows. Changing the grid through getGrid(), adding items or calling invalidate() drops the cached
+    results. Message thread only, and components must outlive the layout or be removed with clear().
+    */
+    class CachedGridLayout {
+    public:
+        enum class TrackSource { grid, columnsFromItems, rowsFromItems };
+
+        CachedGridLayout() = default;
+
+        // The settings performLayout() uses
+        static void useDefaultTemplate (CachedGridLayout& layout) {
+            auto& grid           = layout.getGrid();
+            grid.alignContent    = juce::Grid::AlignContent::spaceAround;
+            grid.autoColumns     = juce::Grid::TrackInfo (Fr (1));
+            grid.autoRows        = juce::Grid::TrackInfo (Fr (1));
+            grid.columnGap       = juce::Grid::Px (80);
+            grid.rowGap          = juce::Grid::Px (80);
+            grid.autoFlow        = juce::Grid::AutoFlow::column;
+            grid.templateColumns = { Fr (1), Fr (1) };
+            grid.templateRows    = { Fr (1), Fr (1) };
+        }
+
+        // For changing the template, gaps, alignment and so on. Marks the layout dirty.
+        juce::Grid& getGrid() {
+            invalidate();
+            return grid;
+        }
+
+        void setTrackSource (TrackSource newSource) {
+            trackSource = newSource;
+            invalidate();
+        }
+
+        // itemTemplate carries the placement, span, margin and so on; its associated component is ignored
+        template <typename ComponentType>
+        void add (ComponentType& component, juce::GridItem itemTemplate = {}) {
+            static_assert (std::is_base_of_v<juce::Component, ComponentType>);
+
+            // Components without TrackInfoTraits, e.g. a plain juce::Label, share the space left over
+            auto track = juce::Grid::TrackInfo (Fr (1));
+            if constexpr (!std::is_void_v<TrackInfoTraitsFor<ComponentType>>)
+                track = TrackInfoTraitsFor<ComponentType>::get (component);
+
+            items.push_back ({ std::move (itemTemplate), &component, nullptr, track });
+            invalidate();
+        }
+
+        void add (CachedGridLayout& child, juce::GridItem itemTemplate = {}, juce::Grid::TrackInfo track = Fr (1)) {
+            jassert (&child != this);
+            items.push_back ({ std::move (itemTemplate), nullptr, &child, track });
+            invalidate();
+        }
+
+        void clear() {
+            items.clear();
+            invalidate();
+        }
+
+        // Drops every cached result, e.g. after an item's size preferences changed
+        void invalidate() noexcept {
+            cache.clear();
+            nextEviction = 0;
+            lastBounds.reset();
+        }
+
+        void performLayout (juce::Rectangle<int> bounds) {
+            if (bounds != lastBounds) { // an empty optional never equals
+                const auto& rectangles = getRectangles (bounds.getWidth(), bounds.getHeight());
+                const auto  origin     = bounds.getPosition();
+
+                for (std::size_t i = 0; i < items.size(); ++i) {
+                    const auto itemBounds = rectangles[i] + origin;
+                    if (auto* component = items[i].component)
+                        component->setBounds (itemBounds); // a no-op for a component already there
+                    items[i].cell = itemBounds;
+                }
+
+                lastBounds = bounds;
+            }
+
+            // Children keep their own caches, so a clean child at the same cell returns straight away
+            for (auto& item : items)
+                if (item.child != nullptr)
+                    item.child->performLayout (item.cell);
+        }
+
+        [[nodiscard]] std::size_t getNumItems() const noexcept { return items.size(); }
+        [[nodiscard]] std::size_t getNumCachedSizes() const noexcept { return cache.size(); }
+
+        // Sizes remembered before the oldest is replaced
+        static constexpr std::size_t maxCachedSizes = 32;
+
+    private:
+        struct Item {
+            juce::GridItem        itemTemplate;
+            juce::Component*      component = nullptr;
+            CachedGridLayout*     child     = nullptr;
+            juce::Grid::TrackInfo track;
+            juce::Rectangle<int>  cell {};
+        };
+
+        struct CachedSize {
+            int                               width = 0, height = 0;
+            std::vector<juce::Rectangle<int>> rectangles;
+        };
+
+        const std::vector<juce::Rectangle<int>>& getRectangles (int width, int height) {
+            for (const auto& entry : cache)
+                if (entry.width == width && entry.height == height)
+                    return entry.rectangles;
+
+            CachedSize computed { width, height, compute (width, height) };
+
+            if (cache.size() < maxCachedSizes) {
+                cache.push_back (std::move (computed));
+                return cache.back().rectangles;
+            }
+
+            auto& slot   = cache[nextEviction];
+            slot         = std::move (computed);
+            nextEviction = (nextEviction + 1) % maxCachedSizes;
+            return slot.rectangles;
+        }
+
+        // Runs the grid on items without components, so nothing is moved while computing
+        std::vector<juce::Rectangle<int>> compute (int width, int height) {
+            auto layoutGrid = grid;
+            layoutGrid.items.clearQuick();
+
+            if (trackSource != TrackSource::grid) {
+                auto& tracks = trackSource == TrackSource::columnsFromItems ? layoutGrid.templateColumns : layoutGrid.templateRows;
+                tracks.clearQuick();
+                for (const auto& item : items)
+                    tracks.add (item.track);
+            }
+
+            for (const auto& item : items) {
+                auto gridItem                = item.itemTemplate;
+                gridItem.associatedComponent = nullptr;
+                layoutGrid.items.add (gridItem);
+            }
+
+            layoutGrid.performLayout ({ 0, 0, width, height });
+
+            std::vector<juce::Rectangle<int>> rectangles;
+            rectangles.reserve (items.size());
+            for (const auto& gridItem : layoutGrid.items)
+                rectangles.push_back (gridItem.currentBounds.toNearestIntEdges());
+            return rectangles;
+        }
+
+        juce::Grid                          grid;
+        TrackSource                         trackSource = TrackSource::grid;
+        std::vector<Item>                   items;
+        std::vector<CachedSize>             cache;
+        std::size_t                         nextEviction = 0;
+        std::optional<juce::Rectangle<int>> lastBounds;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (CachedGridLayout)
+    };
+}
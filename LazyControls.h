@@ -0,0 +1,166 @@
+#pragma once
+
+#include "UIHelpers.h"
+
+namespace moiraesoftware {
+
+    // Placeholder that stands where a control goes in the layout and builds it on demand
+    class LazyControlBase : public juce::Component {
+    public:
+        virtual void               materialise()           = 0;
+        virtual void               release()               = 0;
+        [[nodiscard]] virtual bool isMaterialised() const  = 0;
+    };
+
+    template <typename ComponentType>
+    class LazyControl final : public LazyControlBase {
+    public:
+        using Factory = std::function<std::unique_ptr<ComponentType>()>;
+
+        explicit LazyControl (Factory factoryIn) : factory (std::move (factoryIn)) {}
+
+        void materialise() override {
+            if (control != nullptr)
+                return;
+
+            control = factory();
+            addAndMakeVisible (*control);
+            control->setBounds (getLocalBounds());
+
+            if (onMaterialised)
+                onMaterialised (*control);
+        }
+
+        // Destroys the control, and with it its attachment and parameter listener
+        void release() override { control.reset(); }
+
+        [[nodiscard]] bool isMaterialised() const override { return control != nullptr; }
+
+        // nullptr while the control is not built
+        [[nodiscard]] ComponentType* get() const noexcept { return control.get(); }
+
+        void resized() override {
+            if (control != nullptr)
+                control->setBounds (getLocalBounds());
+        }
+
+        // Set-up that has to be repeated whenever the control is rebuilt, e.g. enableLabel or a LookAndFeel
+        std::function<void (ComponentType&)> onMaterialised;
+
+    private:
+        Factory                        factory;
+        std::unique_ptr<ComponentType> control;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LazyControl)
+    };
+
+    /*
+    Describes an editor's controls up front and only builds an Attached* component, with its attachment, while the
+    page it sits on is visible. A page is whatever component gets shown and hidden as a unit: a tab's content
+    component, a collapsible section, and so on.
+
+        LazyControlRegistry controls;
+        auto& cutoff = controls.add<AttachedSlider> (filterPage, editor, cutoffParam, undoManager, SuffixPolicies::Always {});
+        cutoff.setBounds (...);   // lay the placeholder out like the control itself
+
+    Hidden pages are released by default, so they cost nothing until shown again. WhenHidden::keep leaves built
+    controls alone, for pages that are flipped often and are cheap to keep around. Add pages to the editor before
+    registering their controls, so a hidden page's controls are never built. Message thread only.
+    */
+    class LazyControlRegistry : private juce::ComponentListener {
+    public:
+        enum class WhenHidden { release, keep };
+
+        explicit LazyControlRegistry (WhenHidden whenHiddenIn = WhenHidden::release) : whenHidden (whenHiddenIn) {}
+
+        ~LazyControlRegistry() override {
+            for (auto* page : pages)
+                page->removeComponentListener (this);
+        }
+
+        // The arguments are kept until the control is built: lvalues by reference, rvalues by value
+        template <typename ComponentType, typename... Args>
+        LazyControl<ComponentType>& add (juce::Component& page, Args&&... args) {
+            JUCE_ASSERT_MESSAGE_THREAD
+
+            auto control = std::make_unique<LazyControl<ComponentType>> (
+                [arguments = std::tuple<Args...> (std::forward<Args> (args)...)] {
+                    return std::apply ([] (auto&... a) { return std::make_unique<ComponentType> (a...); }, arguments);
+                });
+
+            auto& placeholder = *control;
+            page.addAndMakeVisible (placeholder);
+            controls.push_back ({ &page, std::move (control) });
+
+            if (std::find (pages.begin(), pages.end(), &page) == pages.end()) {
+                pages.push_back (&page);
+                page.addComponentListener (this);
+            }
+
+            // The other controls on the page already match its visibility, so only the new one needs settling
+            update (placeholder, isVisibleInHierarchy (page));
+            return placeholder;
+        }
+
+        // Builds or releases the controls on a page to match whether it is visible. Called automatically when the
+        // page itself is shown or hidden; call it when an ancestor's visibility changes instead.
+        void refresh (juce::Component& page) {
+            const auto visible = isVisibleInHierarchy (page);
+
+            for (auto& entry : controls)
+                if (entry.page == &page)
+                    update (*entry.control, visible);
+        }
+
+        void refreshAll() {
+            for (auto* page : pages)
+                refresh (*page);
+        }
+
+        [[nodiscard]] int getNumControls() const noexcept { return static_cast<int> (controls.size()); }
+
+        [[nodiscard]] int getNumMaterialised() const noexcept {
+            return static_cast<int> (std::count_if (controls.begin(), controls.end(), [] (const Entry& e) {
+                return e.control->isMaterialised();
+            }));
+        }
+
+    private:
+        struct Entry {
+            juce::Component*                 page;
+            std::unique_ptr<LazyControlBase> control;
+        };
+
+        // Visible up to, but not including, the top-level component. The editor is only made visible once the host
+        // shows it, and controls on the opening page should be built with the editor rather than on its first paint.
+        static bool isVisibleInHierarchy (const juce::Component& component) {
+            for (auto* c = &component; c->getParentComponent() != nullptr; c = c->getParentComponent())
+                if (!c->isVisible())
+                    return false;
+            return true;
+        }
+
+        void update (LazyControlBase& control, bool pageVisible) {
+            if (pageVisible)
+                control.materialise();
+            else if (whenHidden == WhenHidden::release)
+                control.release();
+        }
+
+        void componentVisibilityChanged (juce::Component& page) override { refresh (page); }
+        void componentParentHierarchyChanged (juce::Component& page) override { refresh (page); }
+
+        void componentBeingDeleted (juce::Component& page) override {
+            page.removeComponentListener (this);
+            pages.erase (std::remove (pages.begin(), pages.end(), &page), pages.end());
+            controls.erase (std::remove_if (controls.begin(), controls.end(), [&page] (const Entry& e) { return e.page == &page; }),
+                            controls.end());
+        }
+
+        WhenHidden                    whenHidden;
+        std::vector<juce::Component*> pages;
+        std::vector<Entry>            controls;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LazyControlRegistry)
+    };
+}
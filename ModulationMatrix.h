@@ -0,0 +1,190 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+
+#include "ParameterHandleCache.h"
+#include "TripleBuffer.h"
+
+namespace moiraesoftware {
+
+    /*
+    Modulates parameters from LFOs, envelopes and the like without touching their host-visible values.
+
+    Each source has one row of depths, one per parameter in registry order, in normalised units: a depth of 0.25
+    moves a parameter by a quarter of its slider travel when the source is at 1. Per call of process() the
+    offsets are accumulated with juce::FloatVectorOperations, one multiply-add over the whole row per active
+    source, added to the parameters' current normalised values and clipped to 0..1. Parameters with a route are
+    converted back through their own NormalisableRange, including custom ones such as
+    logarithmicThenLinearRange, so a modulated fader moves the way its slider does. The DSP reads the result
+    instead of the raw values:
+
+        ModulationMatrix<Params> modulation { handles };
+        modulation.setDepth<cutoffID> (lfoSource, 0.3f);       // message thread
+        ...
+        modulation.setSourceValue (lfoSource, lfo.next());     // audio thread, per block or sub-block
+        modulation.process();
+        filter.setCutoff (modulation.get<cutoffID>());
+
+    Depths are edited on the message thread and published through a TripleBuffer, as in PresetMorpher, so
+    process() never locks or allocates. getDisplayValue() gives the UI the last modulated plain value of a
+    parameter as a relaxed atomic, e.g. for AttachedSlider::showModulatedValue.
+    */
+    template <typename Registry, std::size_t MaxSources = 16>
+    class ModulationMatrix {
+    public:
+        static_assert (MaxSources > 0 && MaxSources <= 32, "active sources are kept in one 32-bit mask");
+
+        static constexpr std::size_t numParameters = Registry::size;
+
+        explicit ModulationMatrix (const ParameterHandleCache<Registry>& handlesIn) :
+            handles (handlesIn),
+            editing { std::vector<float> (MaxSources * numParameters, 0.0f), std::vector<std::uint8_t> (numParameters, 0) },
+            banks (editing) {
+            for (std::size_t i = 0; i < numParameters; ++i) {
+                plain[i] = read (i);
+                display[i].store (plain[i], std::memory_order_relaxed);
+            }
+        }
+
+        // Message thread. depth is in normalised units, usually -1..1.
+        void setDepth (std::size_t source, std::size_t parameter, float depth) {
+            jassert (source < MaxSources && parameter < numParameters);
+            editing.depths[source * numParameters + parameter] = depth;
+            rebuildRouting();
+            publish();
+        }
+
+        template <auto& ParamID>
+        void setDepth (std::size_t source, float depth) {
+            setDepth (source, Registry::template indexOf<ParamID>(), depth);
+        }
+
+        [[nodiscard]] float getDepth (std::size_t source, std::size_t parameter) const noexcept {
+            jassert (source < MaxSources && parameter < numParameters);
+            return editing.depths[source * numParameters + parameter];
+        }
+
+        void clearSource (std::size_t source) {
+            jassert (source < MaxSources);
+            std::fill_n (editing.depths.begin() + static_cast<std::ptrdiff_t> (source * numParameters), numParameters, 0.0f);
+            rebuildRouting();
+            publish();
+        }
+
+        // Audio thread. Sources are read by the next process().
+        void setSourceValue (std::size_t source, float value) noexcept {
+            jassert (source < MaxSources);
+            sourceValues[source] = value;
+        }
+
+        // Audio thread, once per block or sub-block, after the sources have been set
+        void process() noexcept {
+            const auto& routes = banks.acquire();
+            const auto  n      = static_cast<int> (numParameters);
+
+            // Custom ranges convert through std::function, so only routed parameters are converted at all. The
+            // vector operations below still run over every slot; the unrouted ones are never read back.
+            for (std::size_t i = 0; i < numParameters; ++i) {
+                plain[i] = read (i);
+                if (routes.routed[i] != 0)
+                    normalised[i] = handles.handle (i).range.convertTo0to1 (plain[i]);
+            }
+
+            juce::FloatVectorOperations::clear (offsets.data(), n);
+            for (auto active = routes.activeSources; active != 0; active &= active - 1) {
+                const auto source = static_cast<std::size_t> (std::countr_zero (active));
+                if (sourceValues[source] != 0.0f)
+                    juce::FloatVectorOperations::addWithMultiply (offsets.data(), routes.depths.data() + source * numParameters, sourceValues[source], n);
+            }
+
+            juce::FloatVectorOperations::add (normalised.data(), offsets.data(), n);
+            juce::FloatVectorOperations::clip (normalised.data(), normalised.data(), 0.0f, 1.0f, n);
+
+            for (std::size_t i = 0; i < numParameters; ++i) {
+                if (routes.routed[i] != 0)
+                    plain[i] = handles.handle (i).range.convertFrom0to1 (normalised[i]);
+                display[i].store (plain[i], std::memory_order_relaxed);
+            }
+        }
+
+        // Modulated plain values, in registry order. Unrouted parameters hold their raw value.
+        [[nodiscard]] const float* getModulatedValues() const noexcept { return plain.data(); }
+
+        [[nodiscard]] float get (std::size_t index) const noexcept {
+            jassert (index < numParameters);
+            return plain[index];
+        }
+
+        template <auto& ParamID>
+        [[nodiscard]] float get() const noexcept {
+            return plain[Registry::template indexOf<ParamID>()];
+        }
+
+        // The modulated value in 0..1, after clipping. Only meaningful for routed parameters; the others are not
+        // converted and hold whatever was left in their slot.
+        [[nodiscard]] float getNormalised (std::size_t index) const noexcept {
+            jassert (index < numParameters);
+            return normalised[index];
+        }
+
+        // Any thread. The plain value from the last process().
+        [[nodiscard]] const std::atomic<float>& getDisplayValue (std::size_t index) const noexcept {
+            jassert (index < numParameters);
+            return display[index];
+        }
+
+        template <auto& ParamID>
+        [[nodiscard]] const std::atomic<float>& getDisplayValue() const noexcept {
+            return display[Registry::template indexOf<ParamID>()];
+        }
+
+    private:
+        struct Routes {
+            std::vector<float>        depths; // MaxSources rows of numParameters
+            std::vector<std::uint8_t> routed; // any non-zero depth per parameter
+            std::uint32_t             activeSources = 0;
+        };
+
+        float read (std::size_t index) const noexcept {
+            const auto* value = handles.handle (index).value;
+            return value != nullptr ? value->load (std::memory_order_relaxed) : 0.0f;
+        }
+
+        void rebuildRouting() {
+            std::fill (editing.routed.begin(), editing.routed.end(), std::uint8_t { 0 });
+            editing.activeSources = 0;
+
+            for (std::size_t source = 0; source < MaxSources; ++source) {
+                const auto* row = editing.depths.data() + source * numParameters;
+                for (std::size_t i = 0; i < numParameters; ++i) {
+                    if (row[i] != 0.0f) {
+                        editing.routed[i] = 1;
+                        editing.activeSources |= 1u << source;
+                    }
+                }
+            }
+        }
+
+        void publish() {
+            JUCE_ASSERT_MESSAGE_THREAD
+            auto& target = banks.getWriteBuffer();
+            std::copy (editing.depths.begin(), editing.depths.end(), target.depths.begin());
+            std::copy (editing.routed.begin(), editing.routed.end(), target.routed.begin());
+            target.activeSources = editing.activeSources;
+            banks.publish();
+        }
+
+        const ParameterHandleCache<Registry>& handles;
+
+        Routes               editing;
+        TripleBuffer<Routes> banks;
+
+        std::array<float, MaxSources>                 sourceValues {};
+        std::array<float, numParameters>              offsets {};
+        std::array<float, numParameters>              normalised {};
+        std::array<float, numParameters>              plain {};
+        std::array<std::atomic<float>, numParameters> display {};
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ModulationMatrix)
+    };
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include "ParameterListener.h"
+
+namespace moiraesoftware {
+
+    /*
+    Change detection without listeners: the audio thread polls the APVTS raw values once per block and compares
+    them with the previous block's copy. It returns the same ParameterDirtyBits as
+    ParameterListenerManager::consumeDirtyParameters(), so the two modes are interchangeable:
+
+        ParameterChangePoller<Params::size> poller { apvts, Params::ids };
+        ...
+        const auto dirty = poller.poll();    // top of processBlock
+        if (dirty.test (cutoffIndex)) updateFilter();
+
+    Nothing runs on the thread that sets a parameter and nothing is written across threads, so the cost is one
+    gather and one compare per watched parameter per block whatever the automation density. The gather is a
+    load through each parameter's pointer into a contiguous array; the compare runs over those arrays 64
+    values at a time and is written so the compiler can vectorise it. Values are compared bit for bit, so any
+    change, however small, is reported.
+
+    A change that is undone before the next poll is not seen, which is the point of comparing values. Only
+    the audio thread may call poll(), markAllDirty() and resync().
+    */
+    template <std::size_t N>
+    class ParameterChangePoller {
+    public:
+        // The ids are copied, so a temporary array is fine
+        ParameterChangePoller (juce::AudioProcessorValueTreeState& state, const std::array<const juce::ParameterID*, N>& ids) {
+            for (std::size_t i = 0; i < N; ++i) {
+                const std::atomic<float>* value = ids[i] != nullptr ? state.getRawParameterValue (ids[i]->getParamID()) : nullptr;
+                jassert (ids[i] == nullptr || value != nullptr); // id not in the layout
+                values[i] = value != nullptr ? value : &unused;
+            }
+            resync();
+        }
+
+        // Returns the parameters whose value differs from the previous poll
+        ParameterDirtyBits<N> poll() noexcept {
+            auto& previous = snapshots[current];
+            current ^= 1;
+            auto& latest = snapshots[current];
+
+            for (std::size_t i = 0; i < N; ++i)
+                latest[i] = std::bit_cast<std::uint32_t> (values[i]->load (std::memory_order_relaxed));
+
+            if (std::exchange (allDirty, false))
+                return ParameterDirtyBits<N>::all();
+
+            ParameterDirtyBits<N> bits;
+            for (std::size_t w = 0; w < ParameterDirtyBits<N>::numWords; ++w) {
+                const auto base  = w * 64;
+                const auto count = std::min<std::size_t> (64, N - base);
+
+                std::uint64_t word = 0;
+                for (std::size_t j = 0; j < count; ++j)
+                    word |= static_cast<std::uint64_t> (latest[base + j] != previous[base + j]) << j;
+
+                bits.words[w] = word;
+            }
+
+            return bits;
+        }
+
+        // The next poll() reports every parameter, e.g. after prepareToPlay
+        void markAllDirty() noexcept { allDirty = true; }
+
+        // Takes the current values as the baseline without reporting them
+        void resync() noexcept {
+            for (std::size_t i = 0; i < N; ++i)
+                snapshots[current][i] = std::bit_cast<std::uint32_t> (values[i]->load (std::memory_order_relaxed));
+        }
+
+        // The values read by the last poll, in id order
+        [[nodiscard]] float getPolledValue (std::size_t index) const noexcept {
+            jassert (index < N);
+            return std::bit_cast<float> (snapshots[current][index]);
+        }
+
+    private:
+        std::array<const std::atomic<float>*, N>                 values {};
+        alignas (64) std::array<std::array<std::uint32_t, N>, 2> snapshots {};
+        std::size_t                                              current  = 0;
+        bool                                                     allDirty = false;
+        std::atomic<float>                                       unused { 0.0f };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParameterChangePoller)
+    };
+
+    // ParameterChangePoller over every id of a ParameterRegistry, with the same compile-time
+    // lookups as RegisteredParameterListenerManager
+    template <typename Registry>
+    class RegisteredParameterChangePoller : public ParameterChangePoller<Registry::size> {
+    public:
+        explicit RegisteredParameterChangePoller (juce::AudioProcessorValueTreeState& state) :
+            ParameterChangePoller<Registry::size> (state, Registry::ids) {}
+
+        template <auto& ParamID>
+        static bool isDirty (const ParameterDirtyBits<Registry::size>& bits) noexcept {
+            return bits.test (Registry::template indexOf<ParamID>());
+        }
+    };
+}
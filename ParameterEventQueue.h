@@ -0,0 +1,198 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+#include "ParameterListener.h"
+
+namespace moiraesoftware {
+
+    struct ParameterEvent {
+        std::uint32_t index        = 0;    // position in the ParameterListenerManager id array
+        float         value        = 0.0f; // plain (denormalised) value, as given to the APVTS listener
+        juce::int64   timestamp    = 0;    // juce::Time::getHighResolutionTicks() when the change was pushed
+        int           sampleOffset = 0;    // filled in by drain(), 0 .. numSamples - 1
+    };
+
+    /*
+    Bounded, lock-free multi-producer/single-consumer queue of parameter changes.
+
+    The producers are whichever threads set the parameters (pass the queue to a ParameterListenerManager as its
+    ParameterChangeSink), e.g. host automation on the audio thread and a knob dragged on the message thread at the
+    same time. Each push reserves a slot by advancing the write index with a CAS and publishes it through the
+    slot's sequence number, so concurrent pushes never share a slot. The consumer is the audio thread, which calls
+    drain() at the top of processBlock; only one thread may drain at a time.
+
+    Nothing allocates after construction. When the ring is full the change is coalesced instead: the latest value
+    per parameter is kept in a fixed slot and delivered by the next drain(), after the ring contents, at the offset
+    of the last delivered event. Further changes to a coalesced parameter keep going to its slot until it has been
+    drained, so the delivered order per parameter is always oldest to newest.
+    */
+    template <std::size_t NumParameters, std::size_t Capacity = 256>
+    class ParameterEventQueue final : public ParameterChangeSink {
+    public:
+        static_assert (Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+        ParameterEventQueue() noexcept {
+            for (std::size_t i = 0; i < Capacity; ++i)
+                slots[i].sequence.store (i, std::memory_order_relaxed);
+        }
+
+        // Producer side
+        void parameterChanged (std::size_t index, float newValue) noexcept override {
+            push (index, newValue, juce::Time::getHighResolutionTicks());
+        }
+
+        // Returns false if the ring was full and the value was coalesced instead
+        bool push (std::size_t index, float value, juce::int64 timestamp) noexcept {
+            jassert (index < NumParameters);
+
+            if (coalesced.isDirty (index)) {
+                coalesce (index, value);
+                return false;
+            }
+
+            // A slot is free for position pos when its sequence is pos, and holds a published event when it is
+            // pos + 1. The consumer hands it back for the next lap by setting it to pos + Capacity.
+            auto pos = writePos.load (std::memory_order_relaxed);
+            for (;;) {
+                const auto sequence = slots[pos & mask].sequence.load (std::memory_order_acquire);
+                const auto lag      = static_cast<std::ptrdiff_t> (sequence - pos);
+
+                if (lag == 0) {
+                    if (writePos.compare_exchange_weak (pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                } else if (lag < 0) {
+                    coalesce (index, value); // the consumer has not freed this slot yet: full
+                    return false;
+                } else {
+                    pos = writePos.load (std::memory_order_relaxed); // another producer took it
+                }
+            }
+
+            auto& slot = slots[pos & mask];
+            slot.event = { static_cast<std::uint32_t> (index), value, timestamp, 0 };
+            slot.sequence.store (pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer side. Calls fn (const ParameterEvent&) for every pending change in order and
+        // returns how many were delivered.
+        //
+        // Events pushed during the previous block are spread over this one by their timestamps,
+        // which keeps their relative timing at the cost of one block of latency. The first block
+        // after construction or reset() delivers everything at offset 0.
+        template <typename Fn>
+        int drain (int numSamples, juce::int64 blockStartTicks, Fn&& fn) noexcept {
+            jassert (numSamples > 0);
+            const ConsumerCheck check (*this);
+
+            const auto previousStart = lastBlockStart;
+            const auto blockTicks    = previousStart > 0 ? blockStartTicks - previousStart : 0;
+            lastBlockStart           = blockStartTicks;
+
+            const auto toOffset = [&] (juce::int64 timestamp) {
+                if (blockTicks <= 0)
+                    return 0;
+                const auto offset = ((timestamp - previousStart) * numSamples) / blockTicks;
+                return static_cast<int> (juce::jlimit<juce::int64> (0, numSamples - 1, offset));
+            };
+
+            int delivered  = 0;
+            int lastOffset = 0;
+
+            // Stops at the first slot that is reserved but not yet published; it is delivered next block
+            for (;; ++readPos) {
+                auto& slot = slots[readPos & mask];
+                if (slot.sequence.load (std::memory_order_acquire) != readPos + 1)
+                    break;
+
+                auto event = slot.event;
+                slot.sequence.store (readPos + Capacity, std::memory_order_release);
+
+                // never step backwards, a producer may be descheduled between timestamping and pushing
+                event.sampleOffset = lastOffset = std::max (lastOffset, toOffset (event.timestamp));
+                fn (event);
+                ++delivered;
+            }
+
+            // Coalesced values are newer than anything in the ring for their parameter, so they wait while a
+            // reserved slot is still unpublished
+            if (readPos != writePos.load (std::memory_order_acquire))
+                return delivered;
+
+            coalesced.exchangeAndClear().forEachDirty ([&] (std::size_t index) {
+                const ParameterEvent event { static_cast<std::uint32_t> (index),
+                                             latestValues[index].load (std::memory_order_acquire),
+                                             blockStartTicks,
+                                             lastOffset };
+                fn (event);
+                ++delivered;
+            });
+
+            return delivered;
+        }
+
+        template <typename Fn>
+        int drain (int numSamples, Fn&& fn) noexcept {
+            return drain (numSamples, juce::Time::getHighResolutionTicks(), std::forward<Fn> (fn));
+        }
+
+        // Consumer side, e.g. from prepareToPlay. Drops anything pending.
+        void reset() noexcept {
+            const ConsumerCheck check (*this);
+            for (;; ++readPos) {
+                auto& slot = slots[readPos & mask];
+                if (slot.sequence.load (std::memory_order_acquire) != readPos + 1)
+                    break;
+                slot.sequence.store (readPos + Capacity, std::memory_order_release);
+            }
+            coalesced.exchangeAndClear();
+            lastBlockStart = 0;
+        }
+
+        [[nodiscard]] static constexpr std::size_t capacity() noexcept { return Capacity; }
+
+    private:
+        // Debug builds assert that drain() and reset() never overlap, which would corrupt readPos
+        struct ConsumerCheck {
+#if JUCE_DEBUG
+            explicit ConsumerCheck (ParameterEventQueue& q) : queue (q) {
+                jassert (!queue.consuming.exchange (true, std::memory_order_acquire)); // one consumer at a time
+            }
+            ~ConsumerCheck() { queue.consuming.store (false, std::memory_order_release); }
+            ParameterEventQueue& queue;
+#else
+            explicit ConsumerCheck (ParameterEventQueue&) noexcept {}
+#endif
+        };
+
+        void coalesce (std::size_t index, float value) noexcept {
+            latestValues[index].store (value, std::memory_order_release);
+            coalesced.markDirty (index);
+        }
+
+        static constexpr std::size_t mask = Capacity - 1;
+
+        struct Slot {
+            std::atomic<std::size_t> sequence { 0 };
+            ParameterEvent           event;
+        };
+
+        std::array<Slot, Capacity> slots;
+
+        // Producer and consumer indices on separate cache lines
+        alignas (64) std::atomic<std::size_t> writePos { 0 };
+        alignas (64) std::size_t              readPos = 0; // consumer only
+
+        std::array<std::atomic<float>, NumParameters> latestValues {};
+        ParameterDirtyMask<NumParameters>             coalesced;
+
+        juce::int64 lastBlockStart = 0; // consumer only
+
+#if JUCE_DEBUG
+        std::atomic<bool> consuming { false };
+#endif
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParameterEventQueue)
+    };
+}
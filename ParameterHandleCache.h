@@ -0,0 +1,102 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include "ParameterRegistry.h"
+
+namespace moiraesoftware {
+
+    struct ParameterHandle {
+        std::atomic<float>*            value     = nullptr;
+        juce::RangedAudioParameter*    parameter = nullptr;
+        juce::NormalisableRange<float> range;
+    };
+
+    /*
+    Resolves every ParamID of a ParameterRegistry against the APVTS once, at processor construction, so audio code
+    reads parameters through a fixed array index instead of a juce::String lookup.
+
+        using Params = ParameterRegistry<gainID, freqID, modeID, bypassID>;
+        ParameterHandleCache<Params> handles { apvts };
+
+        const auto gain   = handles.get<gainID>();          // plain value
+        const auto mode   = handles.get<modeID, int>();     // AudioParameterChoice index
+        const auto bypass = handles.get<bypassID, bool>();
+
+    The cache must not outlive the APVTS it was built from.
+    */
+    template <typename Registry>
+    class ParameterHandleCache {
+    public:
+        explicit ParameterHandleCache (juce::AudioProcessorValueTreeState& state) {
+            for (std::size_t i = 0; i < Registry::size; ++i) {
+                const auto& paramID = Registry::ids[i]->getParamID();
+                auto*       param   = state.getParameter (paramID);
+
+                // Every id in the registry has to have been added to the layout
+                jassert (param != nullptr);
+
+                handles[i].value     = state.getRawParameterValue (paramID);
+                handles[i].parameter = param;
+                if (param != nullptr)
+                    handles[i].range = param->getNormalisableRange();
+            }
+        }
+
+        // Plain value of ParamID, converted to T. bool is true at or above 0.5, integral types round,
+        // matching how AudioParameterBool and AudioParameterChoice store their raw values.
+        template <auto& ParamID, typename T = float>
+        [[nodiscard]] T get() const noexcept {
+            return convert<T> (handle<ParamID>().value->load (std::memory_order_relaxed));
+        }
+
+        template <auto& ParamID>
+        [[nodiscard]] float getNormalised() const noexcept {
+            const auto& h = handle<ParamID>();
+            return h.range.convertTo0to1 (h.value->load (std::memory_order_relaxed));
+        }
+
+        template <auto& ParamID>
+        [[nodiscard]] const juce::NormalisableRange<float>& getRange() const noexcept {
+            return handle<ParamID>().range;
+        }
+
+        template <auto& ParamID>
+        [[nodiscard]] juce::RangedAudioParameter& getParameter() const noexcept {
+            return *handle<ParamID>().parameter;
+        }
+
+        template <auto& ParamID>
+        [[nodiscard]] const ParameterHandle& handle() const noexcept {
+            return handles[Registry::template indexOf<ParamID>()];
+        }
+
+        // Index-based access for loops over the whole registry, e.g. alongside ParameterDirtyBits
+        [[nodiscard]] float get (std::size_t index) const noexcept {
+            jassert (index < Registry::size);
+            return handles[index].value->load (std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] const ParameterHandle& handle (std::size_t index) const noexcept {
+            jassert (index < Registry::size);
+            return handles[index];
+        }
+
+        [[nodiscard]] static constexpr std::size_t size() noexcept { return Registry::size; }
+
+    private:
+        template <typename T>
+        static T convert (float value) noexcept {
+            if constexpr (std::is_same_v<T, bool>)
+                return value >= 0.5f;
+            else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+                return static_cast<T> (juce::roundToInt (value));
+            else
+                return static_cast<T> (value);
+        }
+
+        std::array<ParameterHandle, Registry::size> handles;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParameterHandleCache)
+    };
+}
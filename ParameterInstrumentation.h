@@ -0,0 +1,137 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+#include <bit>
+#include <numeric>
+
+namespace moiraesoftware {
+
+    /*
+    Opt-in activity counters for a ParameterListenerManager: how often each parameter changes, and how long a
+    change waits between the listener callback and the audio thread consuming it with consumeDirtyParameters().
+
+    Recording is a relaxed atomic increment per change plus, for the first change since the last consume, one
+    timestamp. Latencies go into a log2 histogram of high resolution ticks, so recording them needs no division
+    or lock. getSnapshot() only reads the atomics and can be called from the UI or a logging thread at any time;
+    counts recorded while it runs may land in this snapshot or the next.
+
+        ParameterInstrumentation<Params::size> activity;
+        manager.enableInstrumentation (activity);
+        ...
+        const auto snapshot = activity.getSnapshot();
+        DBG ("p99 notify latency " << snapshot.latencyPercentile (0.99) * 1000.0 << " ms");
+    */
+    template <std::size_t N>
+    class ParameterInstrumentation {
+    public:
+        // Bucket b counts latencies of [2^(b-1), 2^b) ticks, bucket 0 counts 0 ticks
+        static constexpr std::size_t numBuckets = 64;
+
+        struct Snapshot {
+            std::array<std::uint64_t, N>          changeCounts {};
+            std::array<std::uint64_t, numBuckets> latencyHistogram {};
+            double                                ticksPerSecond = 1.0;
+
+            [[nodiscard]] std::uint64_t totalChanges() const noexcept {
+                return std::accumulate (changeCounts.begin(), changeCounts.end(), std::uint64_t { 0 });
+            }
+
+            [[nodiscard]] std::uint64_t totalLatencySamples() const noexcept {
+                return std::accumulate (latencyHistogram.begin(), latencyHistogram.end(), std::uint64_t { 0 });
+            }
+
+            // Upper bound in seconds of the bucket holding the given fraction (0..1) of latencies, 0 if none
+            [[nodiscard]] double latencyPercentile (double fraction) const noexcept {
+                const auto total = totalLatencySamples();
+                if (total == 0)
+                    return 0.0;
+
+                const auto    target = static_cast<std::uint64_t> (std::ceil (juce::jlimit (0.0, 1.0, fraction) * static_cast<double> (total)));
+                std::uint64_t seen   = 0;
+
+                for (std::size_t b = 0; b < numBuckets; ++b) {
+                    seen += latencyHistogram[b];
+                    if (seen >= target && seen > 0)
+                        return bucketUpperBound (b);
+                }
+
+                return bucketUpperBound (numBuckets - 1);
+            }
+
+            [[nodiscard]] double bucketUpperBound (std::size_t bucket) const noexcept {
+                return bucket == 0 ? 0.0 : std::ldexp (1.0, static_cast<int> (bucket)) / ticksPerSecond;
+            }
+
+            // Indices of the count busiest parameters, busiest first
+            [[nodiscard]] std::vector<std::size_t> hottest (std::size_t count) const {
+                std::vector<std::size_t> indices (N);
+                std::iota (indices.begin(), indices.end(), std::size_t { 0 });
+                count = std::min (count, N);
+                std::partial_sort (indices.begin(), indices.begin() + static_cast<std::ptrdiff_t> (count), indices.end(),
+                                   [this] (std::size_t a, std::size_t b) { return changeCounts[a] > changeCounts[b]; });
+                indices.resize (count);
+                return indices;
+            }
+        };
+
+        ParameterInstrumentation() = default;
+
+        // Listener side, any thread
+        void recordChange (std::size_t index) noexcept {
+            jassert (index < N);
+            changeCounts[index].fetch_add (1, std::memory_order_relaxed);
+
+            // Latency is measured from the oldest change the audio thread has not consumed yet, so there is
+            // nothing to do, not even reading the clock, while one is pending
+            if (pendingSince[index].load (std::memory_order_relaxed) != 0)
+                return;
+            auto expected = juce::int64 { 0 };
+            pendingSince[index].compare_exchange_strong (expected, now(), std::memory_order_relaxed);
+        }
+
+        // Audio thread, with the bits consumeDirtyParameters() is about to return
+        template <typename DirtyBits>
+        void recordConsumed (const DirtyBits& bits) noexcept {
+            const auto consumedAt = now();
+            bits.forEachDirty ([this, consumedAt] (std::size_t index) {
+                if (const auto since = pendingSince[index].exchange (0, std::memory_order_relaxed); since != 0)
+                    latencyHistogram[bucketFor (consumedAt - since)].fetch_add (1, std::memory_order_relaxed);
+            });
+        }
+
+        [[nodiscard]] Snapshot getSnapshot() const noexcept {
+            Snapshot snapshot;
+            snapshot.ticksPerSecond = static_cast<double> (juce::Time::getHighResolutionTicksPerSecond());
+            for (std::size_t i = 0; i < N; ++i)
+                snapshot.changeCounts[i] = changeCounts[i].load (std::memory_order_relaxed);
+            for (std::size_t b = 0; b < numBuckets; ++b)
+                snapshot.latencyHistogram[b] = latencyHistogram[b].load (std::memory_order_relaxed);
+            return snapshot;
+        }
+
+        // Clears the counts. Changes recorded concurrently may survive the reset.
+        void reset() noexcept {
+            for (auto& c : changeCounts)
+                c.store (0, std::memory_order_relaxed);
+            for (auto& b : latencyHistogram)
+                b.store (0, std::memory_order_relaxed);
+        }
+
+    private:
+        // Never 0, which marks "nothing pending"
+        static juce::int64 now() noexcept { return std::max (juce::int64 { 1 }, juce::Time::getHighResolutionTicks()); }
+
+        static std::size_t bucketFor (juce::int64 ticks) noexcept {
+            if (ticks <= 0)
+                return 0;
+            return std::min<std::size_t> (numBuckets - 1, static_cast<std::size_t> (std::bit_width (static_cast<std::uint64_t> (ticks))));
+        }
+
+        std::array<std::atomic<std::uint64_t>, N>          changeCounts {};
+        std::array<std::atomic<juce::int64>, N>            pendingSince {};
+        std::array<std::atomic<std::uint64_t>, numBuckets> latencyHistogram {};
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParameterInstrumentation)
+    };
+}
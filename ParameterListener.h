@@ -3,9 +3,121 @@
 #include <juce_core/juce_core.h>
 #include <juce_audio_processors/juce_audio_processors.h>
 
+#include "ParameterRegistry.h"
+#include "ParameterInstrumentation.h"
+
+#include <bit>
+
 namespace moiraesoftware
 {
 
+    // Plain copy of a ParameterDirtyMask taken by the audio thread. Bit i corresponds to
+    // position i in the std::array<const juce::ParameterID*, N> given to ParameterListenerManager.
+    template <std::size_t N>
+    struct ParameterDirtyBits
+    {
+        static constexpr std::size_t numWords = (N + 63) / 64;
+
+        // Every one of the N bits set, and none of the unused ones in the last word
+        [[nodiscard]] static ParameterDirtyBits all() noexcept
+        {
+            ParameterDirtyBits bits;
+            for (std::size_t w = 0; w < numWords; ++w)
+            {
+                const auto bitsInWord = std::min<std::size_t> (64, N - w * 64);
+                bits.words[w]         = bitsInWord == 64 ? ~std::uint64_t { 0 } : (std::uint64_t { 1 } << bitsInWord) - 1;
+            }
+            return bits;
+        }
+
+        [[nodiscard]] bool test (std::size_t index) const noexcept
+        {
+            jassert (index < N);
+            return (words[index / 64] >> (index % 64)) & 1u;
+        }
+
+        [[nodiscard]] bool any() const noexcept
+        {
+            return std::any_of (words.begin(), words.end(), [] (std::uint64_t w) { return w != 0; });
+        }
+
+        [[nodiscard]] std::size_t count() const noexcept
+        {
+            std::size_t total = 0;
+            for (const auto w : words)
+                total += static_cast<std::size_t> (std::popcount (w));
+            return total;
+        }
+
+        // Calls fn (index) for every dirty parameter, lowest index first
+        template <typename Fn>
+        void forEachDirty (Fn&& fn) const
+        {
+            for (std::size_t w = 0; w < numWords; ++w)
+            {
+                auto word = words[w];
+                while (word != 0)
+                {
+                    fn (w * 64 + static_cast<std::size_t> (std::countr_zero (word)));
+                    word &= word - 1;
+                }
+            }
+        }
+
+        std::array<std::uint64_t, numWords> words {};
+    };
+
+    // Lock-free N-bit dirty mask. Any thread may mark bits, the audio thread takes and clears
+    // the whole mask once per block with exchangeAndClear().
+    template <std::size_t N>
+    class ParameterDirtyMask
+    {
+    public:
+        static constexpr std::size_t numWords = ParameterDirtyBits<N>::numWords;
+
+        void markDirty (std::size_t index) noexcept
+        {
+            jassert (index < N);
+            words[index / 64].fetch_or (std::uint64_t { 1 } << (index % 64), std::memory_order_release);
+        }
+
+        void markAllDirty() noexcept
+        {
+            const auto all = ParameterDirtyBits<N>::all();
+            for (std::size_t w = 0; w < numWords; ++w)
+                words[w].fetch_or (all.words[w], std::memory_order_release);
+        }
+
+        [[nodiscard]] bool isDirty (std::size_t index) const noexcept
+        {
+            jassert (index < N);
+            return (words[index / 64].load (std::memory_order_acquire) >> (index % 64)) & 1u;
+        }
+
+        // Atomically takes every pending bit and clears it, so a change landing mid-block is
+        // picked up by the next call rather than lost
+        ParameterDirtyBits<N> exchangeAndClear() noexcept
+        {
+            ParameterDirtyBits<N> bits;
+            for (std::size_t w = 0; w < numWords; ++w)
+                bits.words[w] = words[w].exchange (0, std::memory_order_acq_rel);
+            return bits;
+        }
+
+    private:
+        std::array<std::atomic<std::uint64_t>, numWords> words {};
+
+        static_assert (std::atomic<std::uint64_t>::is_always_lock_free);
+    };
+
+    // Receives parameter changes by index from a ParameterListenerManager, on whichever thread
+    // the host or UI set the parameter. Implementations must not block or allocate.
+    struct ParameterChangeSink
+    {
+        virtual ~ParameterChangeSink() = default;
+        virtual void parameterChanged (std::size_t index, float newValue) noexcept = 0;
+    };
+
     struct ParameterListener : juce::AudioProcessorValueTreeState::Listener
     {
         explicit ParameterListener (std::atomic<bool>& needsUpdate) : updateNeeded (needsUpdate) {}
@@ -23,6 +135,33 @@ namespace moiraesoftware
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParameterListener)
     };
 
+    // One listener per watched parameter, so the changed parameter is known by its position
+    // without ever looking at the parameterID string
+    template <std::size_t N>
+    struct IndexedParameterListener : juce::AudioProcessorValueTreeState::Listener
+    {
+        void parameterChanged ([[maybe_unused]] const juce::String& parameterID, float newValue) override
+        {
+            // Recorded before the bit is set, so the release in markDirty publishes the timestamp and a
+            // consume can never land in between and leave it pending
+            if (instrumentation)
+                if (const auto activity = instrumentation->load (std::memory_order_acquire))
+                    activity->recordChange (index);
+            dirtyMask->markDirty (index);
+            if (updateNeeded)
+                updateNeeded->store (true);
+            if (sink)
+                sink->parameterChanged (index, newValue);
+        }
+
+        std::size_t            index        = 0;
+        ParameterDirtyMask<N>* dirtyMask    = nullptr;
+        std::atomic<bool>*     updateNeeded = nullptr;
+        ParameterChangeSink*   sink         = nullptr;
+
+        const std::atomic<ParameterInstrumentation<N>*>* instrumentation = nullptr;
+    };
+
     template <std::size_t N>
     class ParameterListenerManager
     {
@@ -30,34 +169,129 @@ namespace moiraesoftware
         ParameterListenerManager (juce::AudioProcessorValueTreeState& state,
             const std::array<const juce::ParameterID*, N>& channelParameterIds,
             std::atomic<bool>& update)
-            : apvts_ (state),
-              parameterIds (channelParameterIds),
-              listener (update)
+            : ParameterListenerManager (state, channelParameterIds, &update, nullptr)
+        {
+        }
+
+        // Forwards every change with its index and new value, e.g. into a ParameterEventQueue. sink is called on
+        // whichever thread set the parameter, possibly from several threads at once, e.g. host automation on the
+        // audio thread while a UI edit arrives on the message thread; ParameterEventQueue is safe for that.
+        ParameterListenerManager (juce::AudioProcessorValueTreeState& state,
+            const std::array<const juce::ParameterID*, N>& channelParameterIds,
+            ParameterChangeSink& sink)
+            : ParameterListenerManager (state, channelParameterIds, nullptr, &sink)
         {
-            for (const auto& param : parameterIds)
+        }
+
+        // Mask only: the audio thread polls consumeDirtyParameters() instead of a shared flag
+        ParameterListenerManager (juce::AudioProcessorValueTreeState& state,
+            const std::array<const juce::ParameterID*, N>& channelParameterIds)
+            : ParameterListenerManager (state, channelParameterIds, nullptr, nullptr)
+        {
+        }
+
+        ~ParameterListenerManager()
+        {
+            for (std::size_t i = 0; i < N; ++i)
             {
-                if (param)
+                if (const auto param = parameterIds[i])
                 {
-                    apvts_.addParameterListener (param->getParamID(), &listener);
+                    apvts_.removeParameterListener (param->getParamID(), &listeners[i]);
                 }
             }
         }
 
-        ~ParameterListenerManager()
+        // Call once per block on the audio thread. Returns the parameters that changed since the
+        // previous call and clears them.
+        ParameterDirtyBits<N> consumeDirtyParameters() noexcept
         {
-            for (const auto param : parameterIds)
+            auto bits = dirtyMask.exchangeAndClear();
+            if (const auto activity = instrumentation.load (std::memory_order_acquire))
+                activity->recordConsumed (bits);
+            return bits;
+        }
+
+        [[nodiscard]] bool isDirty (std::size_t index) const noexcept { return dirtyMask.isDirty (index); }
+
+        // e.g. after a state restore or prepareToPlay, to force every stage to recompute
+        void markAllDirty() noexcept { dirtyMask.markAllDirty(); }
+
+        // Starts counting changes and notify latency into activity, which must outlive the manager or a
+        // call to disableInstrumentation(). Latency is only recorded by consumeDirtyParameters(), so
+        // flag and sink users who want it should still call that once per block.
+        void enableInstrumentation (ParameterInstrumentation<N>& activity) noexcept
+        {
+            instrumentation.store (&activity, std::memory_order_release);
+        }
+
+        void disableInstrumentation() noexcept { instrumentation.store (nullptr, std::memory_order_release); }
+
+    private:
+        ParameterListenerManager (juce::AudioProcessorValueTreeState& state,
+            const std::array<const juce::ParameterID*, N>& channelParameterIds,
+            std::atomic<bool>* update,
+            ParameterChangeSink* sink)
+            : apvts_ (state),
+              parameterIds (channelParameterIds)
+        {
+            for (std::size_t i = 0; i < N; ++i)
             {
-                if (param)
+                listeners[i].index        = i;
+                listeners[i].dirtyMask    = &dirtyMask;
+                listeners[i].updateNeeded = update;
+                listeners[i].sink         = sink;
+                listeners[i].instrumentation = &instrumentation;
+
+                if (const auto param = parameterIds[i])
                 {
-                    apvts_.removeParameterListener (param->getParamID(), &listener);
+                    apvts_.addParameterListener (param->getParamID(), &listeners[i]);
                 }
             }
         }
 
-    private:
         juce::AudioProcessorValueTreeState& apvts_;
-        const std::array<const juce::ParameterID*, N>& parameterIds;
-        ParameterListener listener;
+        const std::array<const juce::ParameterID*, N> parameterIds; // a copy, the caller's array may be a temporary
+        ParameterDirtyMask<N> dirtyMask;
+        std::atomic<ParameterInstrumentation<N>*> instrumentation { nullptr };
+        std::array<IndexedParameterListener<N>, N> listeners;
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParameterListenerManager)
     };
-}
\ No newline at end of file
+
+    // ParameterListenerManager watching every id of a ParameterRegistry. Each listener already
+    // knows its own index, so a change costs one bit set, and checking a particular parameter is
+    // a constant shift resolved at compile time:
+    //
+    //   auto dirty = manager.consumeDirtyParameters();
+    //   if (ChannelListenerManager::isDirty<freqID> (dirty)) updateFilter();
+    template <typename Registry>
+    class RegisteredParameterListenerManager : public ParameterListenerManager<Registry::size>
+    {
+    public:
+        RegisteredParameterListenerManager (juce::AudioProcessorValueTreeState& state, std::atomic<bool>& update)
+            : ParameterListenerManager<Registry::size> (state, Registry::ids, update)
+        {
+        }
+
+        RegisteredParameterListenerManager (juce::AudioProcessorValueTreeState& state, ParameterChangeSink& sink)
+            : ParameterListenerManager<Registry::size> (state, Registry::ids, sink)
+        {
+        }
+
+        explicit RegisteredParameterListenerManager (juce::AudioProcessorValueTreeState& state)
+            : ParameterListenerManager<Registry::size> (state, Registry::ids)
+        {
+        }
+
+        template <auto& ParamID>
+        static bool isDirty (const ParameterDirtyBits<Registry::size>& bits) noexcept
+        {
+            return bits.test (Registry::template indexOf<ParamID>());
+        }
+
+        template <auto& ParamID>
+        bool isDirty() const noexcept
+        {
+            return ParameterListenerManager<Registry::size>::isDirty (Registry::template indexOf<ParamID>());
+        }
+    };
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+namespace moiraesoftware {
+
+    // Unique type per ParamID object, so two ids compare by identity rather than by string
+    template <auto& ParamID>
+    struct ParamTag {};
+
+    template <auto& A, auto& B>
+    inline constexpr bool isSameParamID = std::is_same_v<ParamTag<A>, ParamTag<B>>;
+
+    template <auto& ParamID, auto&... ParamIDs>
+    inline constexpr std::size_t paramIDCount = (std::size_t { isSameParamID<ParamID, ParamIDs> } + ... + 0);
+
+    // Compile-time map from the ParamID objects used with the makeXParam factories to dense indices.
+    // The index of each id is its position in the pack, which is also its position in ids, so it
+    // lines up with the bits of ParameterListenerManager<size>.
+    //
+    //   inline const juce::ParameterID gainID { "gain", 1 };
+    //   inline const juce::ParameterID freqID { "freq", 1 };
+    //   using ChannelParams = ParameterRegistry<gainID, freqID>;
+    //   static_assert (ChannelParams::indexOf<freqID>() == 1);
+    template <auto&... ParamIDs>
+    struct ParameterRegistry {
+        static constexpr std::size_t size = sizeof...(ParamIDs);
+
+        static_assert ((std::is_same_v<std::remove_cvref_t<decltype (ParamIDs)>, juce::ParameterID> && ...),
+                       "ParameterRegistry entries must be juce::ParameterID objects");
+
+        template <auto& ParamID>
+        static constexpr bool contains = (isSameParamID<ParamID, ParamIDs> || ...);
+
+        template <auto& ParamID>
+        static constexpr std::size_t indexOf() {
+            static_assert (contains<ParamID>, "ParamID is not part of this registry");
+
+            std::size_t index = 0;
+            // stops counting at the first match
+            [[maybe_unused]] const bool notFound = ((isSameParamID<ParamID, ParamIDs> ? false : (++index, true)) && ...);
+            return index;
+        }
+
+        static constexpr std::array<const juce::ParameterID*, size> ids { &ParamIDs... };
+
+        static_assert (((paramIDCount<ParamIDs, ParamIDs...> == 1) && ...),
+                       "A ParamID appears more than once in the registry");
+    };
+}
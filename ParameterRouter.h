@@ -0,0 +1,199 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include "ParameterListener.h"
+
+#include <thread>
+
+namespace moiraesoftware {
+
+    /*
+    One listener per processor that fans parameter changes out by index to any number of subscribers: atomic
+    flags, ParameterDirtyMasks and ParameterChangeSinks such as a ParameterEventQueue.
+
+    The router listens to each watched parameter directly as a juce::AudioProcessorParameter::Listener, so a
+    change is routed by the parameter's processor index through a table built once, without ever looking at
+    its id. Every parameter keeps a bitmask of the subscribers interested in it, so the callback only visits
+    those. Per-channel, global and UI models that watch overlapping parameters subscribe here instead of each
+    registering their own listeners with the APVTS.
+
+        ParameterRouter<Params::size> router { apvts, Params::ids };
+        const auto channel = router.subscribe (channelMask, ParameterRouter<Params::size>::only ({ 0, 1, 2 }));
+        const auto ui      = router.subscribe (uiQueue);
+        ...
+        router.unsubscribe (ui);
+
+    The router owns the subscription table. Subscribing and unsubscribing happen on the message thread and are
+    safe while parameters are being changed on the audio thread: a subscriber is published only once fully
+    written, and unsubscribe() returns only after every callback that could still see it has finished, so the
+    subscriber can be destroyed straight after. Callbacks never lock or allocate. At most MaxSubscribers can be
+    subscribed at once.
+    */
+    template <std::size_t N, std::size_t MaxSubscribers = 64>
+    class ParameterRouter final : private juce::AudioProcessorParameter::Listener {
+    public:
+        static_assert (MaxSubscribers > 0 && MaxSubscribers <= 64, "subscriber sets are kept in one 64-bit word");
+
+        using SubscriptionId = int;
+        static constexpr SubscriptionId invalidSubscription = -1;
+
+        // The ids are copied, so a temporary array is fine
+        ParameterRouter (juce::AudioProcessorValueTreeState& state, const std::array<const juce::ParameterID*, N>& ids) :
+            processorIndexToRoute (static_cast<std::size_t> (state.processor.getParameters().size()), -1) {
+            for (std::size_t i = 0; i < N; ++i) {
+                parameters[i] = ids[i] != nullptr ? state.getParameter (ids[i]->getParamID()) : nullptr;
+                jassert (ids[i] == nullptr || parameters[i] != nullptr); // id not in the layout
+
+                if (auto* parameter = parameters[i]) {
+                    const auto processorIndex = static_cast<std::size_t> (parameter->getParameterIndex());
+                    if (processorIndex < processorIndexToRoute.size())
+                        processorIndexToRoute[processorIndex] = static_cast<int> (i);
+                    parameter->addListener (this);
+                }
+            }
+        }
+
+        ~ParameterRouter() override {
+            for (auto* parameter : parameters)
+                if (parameter != nullptr)
+                    parameter->removeListener (this);
+        }
+
+        // Interest sets
+        static ParameterDirtyBits<N> all() noexcept { return ParameterDirtyBits<N>::all(); }
+
+        static ParameterDirtyBits<N> only (std::initializer_list<std::size_t> indices) noexcept {
+            ParameterDirtyBits<N> bits;
+            for (const auto i : indices) {
+                jassert (i < N);
+                bits.words[i / 64] |= std::uint64_t { 1 } << (i % 64);
+            }
+            return bits;
+        }
+
+        // Each returns invalidSubscription when the table is full
+        SubscriptionId subscribe (std::atomic<bool>& flag, const ParameterDirtyBits<N>& interest = all()) {
+            return add ({ &flag, nullptr, nullptr }, interest);
+        }
+
+        SubscriptionId subscribe (ParameterDirtyMask<N>& mask, const ParameterDirtyBits<N>& interest = all()) {
+            return add ({ nullptr, &mask, nullptr }, interest);
+        }
+
+        // sink is called on whichever thread set the parameter. Host automation and UI edits can arrive on different
+        // threads at once, so the sink must accept concurrent calls, as ParameterEventQueue does.
+        SubscriptionId subscribe (ParameterChangeSink& sink, const ParameterDirtyBits<N>& interest = all()) {
+            return add ({ nullptr, nullptr, &sink }, interest);
+        }
+
+        // Returns once no parameter callback can reach the subscriber any more
+        void unsubscribe (SubscriptionId id) {
+            JUCE_ASSERT_MESSAGE_THREAD
+
+            if (id < 0 || static_cast<std::size_t> (id) >= MaxSubscribers || (used & bitFor (id)) == 0) {
+                jassertfalse;
+                return;
+            }
+
+            const auto keep = ~bitFor (id);
+            for (auto& s : subscribersOf)
+                s.fetch_and (keep);
+
+            waitForReaders();
+            used &= keep;
+        }
+
+        [[nodiscard]] int getNumSubscribers() const noexcept { return std::popcount (used); }
+
+    private:
+        struct Subscriber {
+            std::atomic<bool>*     flag = nullptr;
+            ParameterDirtyMask<N>* mask = nullptr;
+            ParameterChangeSink*   sink = nullptr;
+        };
+
+        static std::uint64_t bitFor (SubscriptionId id) noexcept { return std::uint64_t { 1 } << id; }
+
+        SubscriptionId add (Subscriber subscriber, const ParameterDirtyBits<N>& interest) {
+            JUCE_ASSERT_MESSAGE_THREAD
+
+            const auto free = ~used & (MaxSubscribers == 64 ? ~std::uint64_t { 0 } : (std::uint64_t { 1 } << MaxSubscribers) - 1);
+            if (free == 0) {
+                jassertfalse; // raise MaxSubscribers
+                return invalidSubscription;
+            }
+
+            // A free slot is unreachable from every callback, see unsubscribe()
+            const auto id = static_cast<SubscriptionId> (std::countr_zero (free));
+            subscribers[static_cast<std::size_t> (id)] = subscriber;
+            used |= bitFor (id);
+
+            interest.forEachDirty ([this, id] (std::size_t index) { subscribersOf[index].fetch_or (bitFor (id)); });
+            return id;
+        }
+
+        // Two reader counts, selected by the epoch a callback started in. Flipping the epoch and waiting for the
+        // old count to drain waits out every callback that may have read a subscriber set from before the flip,
+        // without being held up by callbacks that start afterwards.
+        void waitForReaders() {
+            const auto previous = epoch.fetch_xor (1);
+            while (readers[previous].load() != 0)
+                std::this_thread::yield();
+        }
+
+        // A callback only counts as a reader of the epoch that is still current after it registered. Otherwise
+        // one descheduled between reading the epoch and incrementing could register under an epoch a flip has
+        // already drained, and a second unsubscribe would flip back and wait on the other count only.
+        std::atomic<int>& enterReader() noexcept {
+            for (;;) {
+                const auto current = epoch.load();
+                auto&      count   = readers[current];
+                count.fetch_add (1);
+                if (epoch.load() == current)
+                    return count;
+                count.fetch_sub (1);
+            }
+        }
+
+        void parameterValueChanged (int parameterIndex, float newValue) override {
+            const auto processorIndex = static_cast<std::size_t> (parameterIndex);
+            if (processorIndex >= processorIndexToRoute.size())
+                return;
+
+            const auto route = processorIndexToRoute[processorIndex];
+            if (route < 0)
+                return;
+
+            const auto index = static_cast<std::size_t> (route);
+            auto&      count = enterReader();
+
+            auto targets = subscribersOf[index].load();
+            while (targets != 0) {
+                const auto& subscriber = subscribers[static_cast<std::size_t> (std::countr_zero (targets))];
+                targets &= targets - 1;
+
+                if (subscriber.flag != nullptr)
+                    subscriber.flag->store (true);
+                else if (subscriber.mask != nullptr)
+                    subscriber.mask->markDirty (index);
+                else
+                    subscriber.sink->parameterChanged (index, parameters[index]->convertFrom0to1 (newValue));
+            }
+
+            count.fetch_sub (1);
+        }
+
+        void parameterGestureChanged (int, bool) override {}
+
+        std::array<juce::RangedAudioParameter*, N> parameters {};
+        std::vector<int>                           processorIndexToRoute;
+        std::array<std::atomic<std::uint64_t>, N>  subscribersOf {};
+        std::array<Subscriber, MaxSubscribers>     subscribers {};
+        std::uint64_t                              used = 0; // message thread only
+        std::atomic<std::uint32_t>                 epoch { 0 };
+        std::array<std::atomic<int>, 2>            readers {};
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParameterRouter)
+    };
+}
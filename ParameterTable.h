@@ -0,0 +1,117 @@
+#pragma once
+
+#include "ParameterReferences.h"
+
+namespace moiraesoftware {
+
+    // How a float parameter's value is shown and typed in, one per makeXParam factory
+    enum class UnitKind {
+        plain,        // makeStandardParam
+        decibels,     // makeDBParam
+        frequencyHz,  // makeFrequencyParam<..., FrequencyUnit::Hz>
+        frequencyKHz, // makeFrequencyParam<..., FrequencyUnit::kHz>
+        percent,      // makePercentParam
+        pan,
+        milliseconds, // makeMsParam
+        rateHz,       // makeRateParam
+        ratio,        // makeRatioParam
+        seconds,      // makeSecondsParam
+        degrees,      // makeDegreesParam
+        multiplier,   // makeMultiplierParam
+        bits          // makeBitsParam
+    };
+
+    inline constexpr std::size_t numUnitKinds = static_cast<std::size_t> (UnitKind::bits) + 1;
+
+    // A NormalisableRange that can live in a constexpr table
+    struct RangeSpec {
+        enum class Shape { linear, logarithmicThenLinear };
+
+        float start         = 0.0f;
+        float end           = 1.0f;
+        float interval      = 0.0f;
+        float skew          = 1.0f;
+        bool  symmetricSkew = false;
+        Shape shape         = Shape::linear;
+        float zeroPoint     = 0.0f;
+
+        // The logarithmicThenLinearRange shape, e.g. a -60 dB to +12 dB fader with 0 dB at the breakpoint
+        static constexpr RangeSpec logarithmicThenLinear (float start, float end, float zeroPoint) {
+            return { start, end, 0.001f, 1.0f, false, Shape::logarithmicThenLinear, zeroPoint };
+        }
+
+        [[nodiscard]] juce::NormalisableRange<float> toRange() const {
+            if (shape == Shape::logarithmicThenLinear)
+                return logarithmicThenLinearRange (start, end, zeroPoint);
+            return juce::NormalisableRange<float> (start, end, interval, skew, symmetricSkew);
+        }
+    };
+
+    // One row of a parameter table. The id refers to a juce::ParameterID with static storage, as used with
+    // ParameterRegistry, so the table itself can be constexpr.
+    struct ParameterSpec {
+        const juce::ParameterID& id;
+        std::string_view         name;
+        RangeSpec                range;
+        float                    defaultValue = 0.0f;
+        UnitKind                 unit         = UnitKind::plain;
+    };
+
+    /*
+    The formatter and parser pair for each UnitKind, built once per process and never changed. Every parameter
+    of a kind is constructed from the same attributes object, so a layout of thousands of parameters does not
+    build thousands of attribute sets, and the lambdas it copies from are the stateless ones the factories use.
+    */
+    class UnitFormatters {
+    public:
+        static const juce::AudioParameterFloatAttributes& get (UnitKind unit) {
+            static const UnitFormatters formatters;
+            return formatters.attributes[static_cast<std::size_t> (unit)];
+        }
+
+    private:
+        UnitFormatters() {
+            set (UnitKind::plain, stringFromValue, valueFromString);
+            set (UnitKind::decibels, stringFromDBValue, dBFromString);
+            set (UnitKind::frequencyHz, makeStringFromValueWithFrequency<FrequencyUnit::Hz>(), makeFromStringWithFrequency<FrequencyUnit::Hz>());
+            set (UnitKind::frequencyKHz, makeStringFromValueWithFrequency<FrequencyUnit::kHz>(), makeFromStringWithFrequency<FrequencyUnit::kHz>());
+            set (UnitKind::percent, stringFromPercentValueWithDigits<1>, percentValueFromString);
+            set (UnitKind::pan, stringFromPanValue, panFromString);
+            set (UnitKind::milliseconds, stringFromMsValue, msValueFromString);
+            set (UnitKind::rateHz, stringFromRateHz, rateHzFromString);
+            set (UnitKind::ratio, stringFromRatioValue, ratioValueFromString);
+            set (UnitKind::seconds, stringFromSecondsValue, secondsValueFromString);
+            set (UnitKind::degrees, stringFromDegreesValue, degreesValueFromString);
+            set (UnitKind::multiplier, stringFromMultiplierValue, multiplierValueFromString);
+            set (UnitKind::bits, stringFromBitsValue, bitsValueFromString);
+        }
+
+        template <typename ToString, typename FromString>
+        void set (UnitKind unit, ToString toString, FromString fromString) {
+            attributes[static_cast<std::size_t> (unit)] = juce::AudioParameterFloatAttributes()
+                                                              .withStringFromValueFunction (toString)
+                                                              .withValueFromStringFunction (fromString);
+        }
+
+        std::array<juce::AudioParameterFloatAttributes, numUnitKinds> attributes;
+    };
+
+    // Adds every row of a table to a layout or group in one pass, in table order
+    template <typename Group, typename Specs>
+    void addParameters (Group& layout, const Specs& specs) {
+        for (const ParameterSpec& spec : specs)
+            addToLayout<juce::AudioParameterFloat> (layout,
+                                                    spec.id,
+                                                    juce::String::fromUTF8 (spec.name.data(), static_cast<int> (spec.name.size())),
+                                                    spec.range.toRange(),
+                                                    spec.defaultValue,
+                                                    UnitFormatters::get (spec.unit));
+    }
+
+    template <typename Specs>
+    juce::AudioProcessorValueTreeState::ParameterLayout makeParameterLayout (const Specs& specs) {
+        juce::AudioProcessorValueTreeState::ParameterLayout layout;
+        addParameters (layout, specs);
+        return layout;
+    }
+}
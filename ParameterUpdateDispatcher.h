@@ -0,0 +1,381 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_gui_basics/juce_gui_basics.h>
+
+namespace moiraesoftware {
+
+    class BatchedParameterAttachment;
+
+    /*
+    Editor-wide replacement for the per-attachment AsyncUpdater in juce::ParameterAttachment.
+
+    Parameter changes from non-message threads only mark their attachment dirty (one atomic store, latest value wins).
+    Once per display frame the dispatcher walks the attachments that have something pending and applies them, so
+    dense automation of hundreds of parameters costs one message-thread callback per frame instead of one per change.
+
+    Create one per editor, before any of the attachments that use it, and pass it to the Attached* constructors
+    that take a ParameterUpdateDispatcher. Controls that show values the audio thread publishes, such as the
+    modulation marker of AttachedSlider, register a FrameListener and are polled from the same frame callback.
+    */
+    class ParameterUpdateDispatcher {
+    public:
+        // Called on the message thread once per display frame, after the pending updates
+        struct FrameListener {
+            virtual ~FrameListener() = default;
+            virtual void frameUpdate() = 0;
+        };
+
+        explicit ParameterUpdateDispatcher (juce::Component& editor) :
+            vBlankAttachment (&editor, [this] { onFrame(); }) {}
+
+        ~ParameterUpdateDispatcher() {
+            // attachments and frame listeners unregister themselves, so they have to be destroyed first
+            jassert (attachments.empty() && frameListeners.empty());
+        }
+
+        // Applies everything pending now rather than at the next frame, e.g. before taking a screenshot
+        void dispatchPendingUpdates();
+
+        void addFrameListener (FrameListener& listener) {
+            JUCE_ASSERT_MESSAGE_THREAD
+            frameListeners.push_back (&listener);
+        }
+
+        void removeFrameListener (FrameListener& listener) {
+            JUCE_ASSERT_MESSAGE_THREAD
+            frameListeners.erase (std::remove (frameListeners.begin(), frameListeners.end(), &listener), frameListeners.end());
+        }
+
+    private:
+        friend class BatchedParameterAttachment;
+
+        void add (BatchedParameterAttachment& attachment) {
+            JUCE_ASSERT_MESSAGE_THREAD
+            attachments.push_back (&attachment);
+        }
+
+        void remove (BatchedParameterAttachment& attachment) {
+            JUCE_ASSERT_MESSAGE_THREAD
+            attachments.erase (std::remove (attachments.begin(), attachments.end(), &attachment), attachments.end());
+        }
+
+        void markPending() noexcept { anyPending.store (true, std::memory_order_release); }
+
+        void onFrame() {
+            dispatchPendingUpdates();
+            for (auto* listener : frameListeners)
+                listener->frameUpdate();
+        }
+
+        std::vector<BatchedParameterAttachment*> attachments;
+        std::vector<FrameListener*>              frameListeners;
+        std::atomic<bool>                        anyPending { false };
+        juce::VBlankAttachment                   vBlankAttachment;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParameterUpdateDispatcher)
+    };
+
+    // Same interface as juce::ParameterAttachment, but updates from other threads are delivered by a
+    // ParameterUpdateDispatcher on the next display frame. Changes made on the message thread are still applied
+    // straight away, so the control never lags behind the user.
+    class BatchedParameterAttachment final : private juce::AudioProcessorParameter::Listener {
+    public:
+        BatchedParameterAttachment (ParameterUpdateDispatcher&   dispatcherIn,
+                                    juce::RangedAudioParameter&  param,
+                                    std::function<void (float)>  parameterChangedCallback,
+                                    juce::UndoManager*           um = nullptr) :
+            dispatcher (dispatcherIn),
+            parameter (param),
+            undoManager (um),
+            setValue (std::move (parameterChangedCallback)) {
+            dispatcher.add (*this);
+            parameter.addListener (this);
+        }
+
+        ~BatchedParameterAttachment() override {
+            parameter.removeListener (this);
+            dispatcher.remove (*this);
+        }
+
+        void sendInitialUpdate() { parameterValueChanged ({}, parameter.getValue()); }
+
+        void setValueAsCompleteGesture (float newDenormalisedValue) {
+            callIfParameterValueChanged (newDenormalisedValue, [this] (float f) {
+                beginGesture();
+                parameter.setValueNotifyingHost (f);
+                endGesture();
+            });
+        }
+
+        void beginGesture() {
+            if (undoManager != nullptr)
+                undoManager->beginNewTransaction();
+
+            parameter.beginChangeGesture();
+        }
+
+        void setValueAsPartOfGesture (float newDenormalisedValue) {
+            callIfParameterValueChanged (newDenormalisedValue, [this] (float f) { parameter.setValueNotifyingHost (f); });
+        }
+
+        void endGesture() { parameter.endChangeGesture(); }
+
+    private:
+        friend class ParameterUpdateDispatcher;
+
+        // Message thread, from the dispatcher
+        void applyPendingUpdate() {
+            if (pending.exchange (false, std::memory_order_acq_rel))
+                apply (lastValue.load (std::memory_order_acquire));
+        }
+
+        void apply (float normalisedValue) {
+            if (setValue != nullptr)
+                setValue (parameter.convertFrom0to1 (normalisedValue));
+        }
+
+        void parameterValueChanged (int, float newValue) override {
+            lastValue.store (newValue, std::memory_order_release);
+
+            if (juce::MessageManager::existsAndIsCurrentThread()) {
+                pending.store (false, std::memory_order_release);
+                apply (newValue);
+            } else if (!pending.exchange (true, std::memory_order_acq_rel)) {
+                dispatcher.markPending();
+            }
+        }
+
+        void parameterGestureChanged (int, bool) override {}
+
+        template <typename Callback>
+        void callIfParameterValueChanged (float newDenormalisedValue, Callback&& callback) {
+            const auto newValue = parameter.convertTo0to1 (newDenormalisedValue);
+
+            if (!juce::approximatelyEqual (parameter.getValue(), newValue))
+                callback (newValue);
+        }
+
+        ParameterUpdateDispatcher&  dispatcher;
+        juce::RangedAudioParameter& parameter;
+        juce::UndoManager*          undoManager = nullptr;
+        std::function<void (float)> setValue;
+        std::atomic<float>          lastValue { 0.0f };
+        std::atomic<bool>           pending { false };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BatchedParameterAttachment)
+    };
+
+    inline void ParameterUpdateDispatcher::dispatchPendingUpdates() {
+        if (!anyPending.exchange (false, std::memory_order_acq_rel))
+            return;
+
+        for (auto* attachment : attachments)
+            attachment->applyPendingUpdate();
+    }
+
+    // Holds a juce::ParameterAttachment, or a BatchedParameterAttachment when given a dispatcher, behind the
+    // interface the two share. Used by the attachments and Attached* components that can opt into batching.
+    class OptionallyBatchedParameterAttachment {
+    public:
+        OptionallyBatchedParameterAttachment (juce::RangedAudioParameter& param,
+                                              std::function<void (float)> parameterChangedCallback,
+                                              juce::UndoManager*          undoManager,
+                                              ParameterUpdateDispatcher*  dispatcher) {
+            if (dispatcher != nullptr)
+                batched.emplace (*dispatcher, param, std::move (parameterChangedCallback), undoManager);
+            else
+                direct.emplace (param, std::move (parameterChangedCallback), undoManager);
+        }
+
+        void sendInitialUpdate() { call ([] (auto& a) { a.sendInitialUpdate(); }); }
+        void setValueAsCompleteGesture (float v) { call ([v] (auto& a) { a.setValueAsCompleteGesture (v); }); }
+        void beginGesture() { call ([] (auto& a) { a.beginGesture(); }); }
+        void setValueAsPartOfGesture (float v) { call ([v] (auto& a) { a.setValueAsPartOfGesture (v); }); }
+        void endGesture() { call ([] (auto& a) { a.endGesture(); }); }
+
+        [[nodiscard]] bool isBatched() const noexcept { return batched.has_value(); }
+
+        // Only when constructed without a dispatcher
+        juce::ParameterAttachment& getDirectAttachment() {
+            jassert (direct.has_value());
+            return *direct;
+        }
+
+    private:
+        template <typename Fn>
+        void call (Fn&& fn) {
+            if (batched)
+                fn (*batched);
+            else
+                fn (*direct);
+        }
+
+        std::optional<juce::ParameterAttachment> direct;
+        std::optional<BatchedParameterAttachment> batched;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (OptionallyBatchedParameterAttachment)
+    };
+
+    // The juce::SliderParameterAttachment behaviour on top of a BatchedParameterAttachment
+    class BatchedSliderParameterAttachment final : private juce::Slider::Listener {
+    public:
+        BatchedSliderParameterAttachment (ParameterUpdateDispatcher&  dispatcher,
+                                          juce::RangedAudioParameter& param,
+                                          juce::Slider&               s,
+                                          juce::UndoManager*          undoManager = nullptr) :
+            slider (s), attachment (dispatcher, param, [this] (float f) { setValue (f); }, undoManager) {
+            slider.valueFromTextFunction = [&param] (const juce::String& text) {
+                return static_cast<double> (param.convertFrom0to1 (param.getValueForText (text)));
+            };
+            slider.textFromValueFunction = [&param] (double value) {
+                return param.getText (param.convertTo0to1 (static_cast<float> (value)), 0);
+            };
+            slider.setDoubleClickReturnValue (true, param.convertFrom0to1 (param.getDefaultValue()));
+
+            auto range = param.getNormalisableRange();
+
+            auto convertFrom0To1Function = [range] (double currentRangeStart, double currentRangeEnd, double normalisedValue) mutable {
+                range.start = static_cast<float> (currentRangeStart);
+                range.end   = static_cast<float> (currentRangeEnd);
+                return static_cast<double> (range.convertFrom0to1 (static_cast<float> (normalisedValue)));
+            };
+
+            auto convertTo0To1Function = [range] (double currentRangeStart, double currentRangeEnd, double mappedValue) mutable {
+                range.start = static_cast<float> (currentRangeStart);
+                range.end   = static_cast<float> (currentRangeEnd);
+                return static_cast<double> (range.convertTo0to1 (static_cast<float> (mappedValue)));
+            };
+
+            auto snapToLegalValueFunction = [range] (double currentRangeStart, double currentRangeEnd, double mappedValue) mutable {
+                range.start = static_cast<float> (currentRangeStart);
+                range.end   = static_cast<float> (currentRangeEnd);
+                return static_cast<double> (range.snapToLegalValue (static_cast<float> (mappedValue)));
+            };
+
+            juce::NormalisableRange<double> newRange { static_cast<double> (range.start),
+                                                       static_cast<double> (range.end),
+                                                       std::move (convertFrom0To1Function),
+                                                       std::move (convertTo0To1Function),
+                                                       std::move (snapToLegalValueFunction) };
+            newRange.interval      = range.interval;
+            newRange.skew          = range.skew;
+            newRange.symmetricSkew = range.symmetricSkew;
+
+            slider.setNormalisableRange (newRange);
+
+            attachment.sendInitialUpdate();
+            slider.valueChanged();
+            slider.addListener (this);
+        }
+
+        ~BatchedSliderParameterAttachment() override { slider.removeListener (this); }
+
+        void sendInitialUpdate() { attachment.sendInitialUpdate(); }
+
+    private:
+        void setValue (float newValue) {
+            const juce::ScopedValueSetter<bool> svs (ignoreCallbacks, true);
+            slider.setValue (newValue, juce::sendNotificationSync);
+        }
+
+        void sliderValueChanged (juce::Slider*) override {
+            if (!ignoreCallbacks)
+                attachment.setValueAsPartOfGesture (static_cast<float> (slider.getValue()));
+        }
+
+        void sliderDragStarted (juce::Slider*) override { attachment.beginGesture(); }
+        void sliderDragEnded (juce::Slider*) override { attachment.endGesture(); }
+
+        juce::Slider&              slider;
+        BatchedParameterAttachment attachment;
+        bool                       ignoreCallbacks = false;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BatchedSliderParameterAttachment)
+    };
+
+    // The juce::ButtonParameterAttachment behaviour on top of a BatchedParameterAttachment
+    class BatchedButtonParameterAttachment final : private juce::Button::Listener {
+    public:
+        BatchedButtonParameterAttachment (ParameterUpdateDispatcher&  dispatcher,
+                                          juce::RangedAudioParameter& param,
+                                          juce::Button&               b,
+                                          juce::UndoManager*          undoManager = nullptr) :
+            button (b), attachment (dispatcher, param, [this] (float f) { setValue (f); }, undoManager) {
+            attachment.sendInitialUpdate();
+            button.addListener (this);
+        }
+
+        ~BatchedButtonParameterAttachment() override { button.removeListener (this); }
+
+        void sendInitialUpdate() { attachment.sendInitialUpdate(); }
+
+    private:
+        void setValue (float newValue) {
+            const juce::ScopedValueSetter<bool> svs (ignoreCallbacks, true);
+            button.setToggleState (newValue >= 0.5f, juce::sendNotificationSync);
+        }
+
+        void buttonClicked (juce::Button*) override {
+            if (ignoreCallbacks)
+                return;
+
+            attachment.setValueAsCompleteGesture (button.getToggleState() ? 1.0f : 0.0f);
+        }
+
+        juce::Button&              button;
+        BatchedParameterAttachment attachment;
+        bool                       ignoreCallbacks = false;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BatchedButtonParameterAttachment)
+    };
+
+    // The juce::ComboBoxParameterAttachment behaviour on top of a BatchedParameterAttachment
+    class BatchedComboBoxParameterAttachment final : private juce::ComboBox::Listener {
+    public:
+        BatchedComboBoxParameterAttachment (ParameterUpdateDispatcher&  dispatcher,
+                                            juce::RangedAudioParameter& param,
+                                            juce::ComboBox&             c,
+                                            juce::UndoManager*          undoManager = nullptr) :
+            comboBox (c),
+            storedParameter (param),
+            attachment (dispatcher, param, [this] (float f) { setValue (f); }, undoManager) {
+            attachment.sendInitialUpdate();
+            comboBox.addListener (this);
+        }
+
+        ~BatchedComboBoxParameterAttachment() override { comboBox.removeListener (this); }
+
+        void sendInitialUpdate() { attachment.sendInitialUpdate(); }
+
+    private:
+        void setValue (float newValue) {
+            const auto normValue = storedParameter.convertTo0to1 (newValue);
+            const auto index     = juce::roundToInt (normValue * static_cast<float> (comboBox.getNumItems() - 1));
+
+            if (index == comboBox.getSelectedItemIndex())
+                return;
+
+            const juce::ScopedValueSetter<bool> svs (ignoreCallbacks, true);
+            comboBox.setSelectedItemIndex (index, juce::sendNotificationSync);
+        }
+
+        void comboBoxChanged (juce::ComboBox*) override {
+            if (ignoreCallbacks)
+                return;
+
+            const auto numItems = comboBox.getNumItems();
+            const auto selected = static_cast<float> (comboBox.getSelectedItemIndex());
+            const auto newValue = numItems > 1 ? selected / static_cast<float> (numItems - 1) : 0.0f;
+
+            attachment.setValueAsCompleteGesture (storedParameter.convertFrom0to1 (newValue));
+        }
+
+        juce::ComboBox&             comboBox;
+        juce::RangedAudioParameter& storedParameter;
+        BatchedParameterAttachment  attachment;
+        bool                        ignoreCallbacks = false;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BatchedComboBoxParameterAttachment)
+    };
+}
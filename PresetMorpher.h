@@ -0,0 +1,224 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+
+#include "ParameterHandleCache.h"
+#include "ParameterListener.h"
+#include "TripleBuffer.h"
+
+namespace moiraesoftware {
+
+    /*
+    Morphs between up to MaxSnapshots stored parameter states from the audio thread, e.g. under an XY pad or a
+    macro knob.
+
+    Snapshots are contiguous arrays of normalised values in registry order. The blend is a weighted sum over
+    every parameter at once with juce::FloatVectorOperations, so it vectorises across the whole registry.
+    Discrete parameters (AudioParameterChoice and AudioParameterBool, as used by AttachedCombo and AttachedToggle)
+    are not interpolated: they take the value of the snapshot with the largest weight, so they switch where that
+    snapshot takes over.
+
+    process() never writes to the parameters themselves: that would run every APVTS and attachment listener on the
+    audio thread. The morphed plain values go to an array the DSP reads instead of the raw values, and the
+    parameters whose value moved are marked for pushToHost(), which the message thread calls, e.g. from a timer,
+    to set them inside a change gesture so the host and the UI follow.
+
+    Snapshots are edited on the message thread and published through a triple buffer, weights are atomics, and
+    process() never locks or allocates:
+
+        PresetMorpher<Params> morpher { handles };
+        morpher.captureSnapshot (0);               // message thread, from the current parameter values
+        morpher.captureSnapshot (1);
+        morpher.setWeights ({ 1.0f - x, x });      // any thread
+        morpher.process();                         // audio thread, once per block
+        filter.setCutoff (morpher.get<cutoffID>());
+        ...
+        morpher.pushToHost();                      // message thread, e.g. from timerCallback()
+    */
+    template <typename Registry, std::size_t MaxSnapshots = 8>
+    class PresetMorpher {
+    public:
+        static constexpr std::size_t numParameters = Registry::size;
+
+        explicit PresetMorpher (const ParameterHandleCache<Registry>& handlesIn) :
+            handles (handlesIn),
+            editing (MaxSnapshots * numParameters, 0.0f),
+            banks (editing) {
+            for (std::size_t i = 0; i < numParameters; ++i) {
+                const auto* parameter = handles.handle (i).parameter;
+                discrete[i]           = parameter != nullptr && parameter->isDiscrete();
+                blended[i]            = parameter != nullptr ? parameter->getValue() : 0.0f;
+                applied[i]            = blended[i];
+                morphed[i]            = read (i);
+                hostValues[i].store (blended[i], std::memory_order_relaxed);
+            }
+
+            for (auto& w : weights)
+                w.store (0.0f, std::memory_order_relaxed);
+        }
+
+        // Message thread. Stores the current value of every parameter in a slot.
+        void captureSnapshot (std::size_t slot) {
+            jassert (slot < MaxSnapshots);
+            auto* values = editing.data() + slot * numParameters;
+            for (std::size_t i = 0; i < numParameters; ++i)
+                if (const auto* parameter = handles.handle (i).parameter)
+                    values[i] = parameter->getValue();
+            publish();
+        }
+
+        // Message thread. normalisedValues holds numParameters values in registry order.
+        void setSnapshot (std::size_t slot, const float* normalisedValues) {
+            jassert (slot < MaxSnapshots);
+            std::copy (normalisedValues, normalisedValues + numParameters, editing.data() + slot * numParameters);
+            publish();
+        }
+
+        [[nodiscard]] const float* getSnapshot (std::size_t slot) const noexcept {
+            jassert (slot < MaxSnapshots);
+            return editing.data() + slot * numParameters;
+        }
+
+        // Any thread. Weights need not add up to 1, they are normalised by process().
+        void setWeight (std::size_t slot, float weight) noexcept {
+            jassert (slot < MaxSnapshots);
+            weights[slot].store (juce::jmax (0.0f, weight), std::memory_order_relaxed);
+        }
+
+        void setWeights (std::initializer_list<float> newWeights) noexcept {
+            jassert (newWeights.size() <= MaxSnapshots);
+            std::size_t slot = 0;
+            for (const auto w : newWeights)
+                setWeight (slot++, w);
+            while (slot < MaxSnapshots)
+                setWeight (slot++, 0.0f);
+        }
+
+        // Audio thread. Blends the snapshots with the current weights into the morphed values and returns how many
+        // parameters changed. With every weight at 0 the morphed values follow the parameters.
+        int process() noexcept {
+            const auto* snapshots = banks.acquire().data();
+
+            std::array<float, MaxSnapshots> w {};
+            float       total    = 0.0f;
+            std::size_t dominant = 0;
+
+            for (std::size_t slot = 0; slot < MaxSnapshots; ++slot) {
+                w[slot] = weights[slot].load (std::memory_order_relaxed);
+                total += w[slot];
+                if (w[slot] > w[dominant])
+                    dominant = slot;
+            }
+
+            if (total <= 0.0f) {
+                for (std::size_t i = 0; i < numParameters; ++i)
+                    morphed[i] = read (i);
+                followingParameters = true;
+                return 0;
+            }
+
+            // The parameters may have moved while the morph was idle, so the next blend is compared against
+            // where they are now rather than against what the morph last applied
+            if (std::exchange (followingParameters, false))
+                for (std::size_t i = 0; i < numParameters; ++i)
+                    applied[i] = handles.handle (i).range.convertTo0to1 (read (i));
+
+            const auto n     = static_cast<int> (numParameters);
+            bool       first = true;
+
+            for (std::size_t slot = 0; slot < MaxSnapshots; ++slot) {
+                if (w[slot] <= 0.0f)
+                    continue;
+
+                const auto* values = snapshots + slot * numParameters;
+                if (first)
+                    juce::FloatVectorOperations::copyWithMultiply (blended.data(), values, w[slot] / total, n);
+                else
+                    juce::FloatVectorOperations::addWithMultiply (blended.data(), values, w[slot] / total, n);
+                first = false;
+            }
+
+            const auto* dominantValues = snapshots + dominant * numParameters;
+            int         changed        = 0;
+
+            for (std::size_t i = 0; i < numParameters; ++i) {
+                const auto value = discrete[i] ? dominantValues[i] : blended[i];
+
+                if (std::abs (value - applied[i]) > tolerance) {
+                    applied[i] = value;
+                    morphed[i] = handles.handle (i).range.convertFrom0to1 (value);
+                    hostValues[i].store (value, std::memory_order_relaxed);
+                    hostPending.markDirty (i);
+                    ++changed;
+                }
+            }
+
+            return changed;
+        }
+
+        // Morphed plain values in registry order, for the DSP to read instead of the raw parameter values
+        [[nodiscard]] const float* getMorphedValues() const noexcept { return morphed.data(); }
+
+        [[nodiscard]] float get (std::size_t index) const noexcept {
+            jassert (index < numParameters);
+            return morphed[index];
+        }
+
+        template <auto& ParamID>
+        [[nodiscard]] float get() const noexcept {
+            return morphed[Registry::template indexOf<ParamID>()];
+        }
+
+        // The last blend, before discrete parameters were switched, in registry order
+        [[nodiscard]] const float* getBlended() const noexcept { return blended.data(); }
+
+        // Message thread. Sets every parameter the morph moved since the last call to its latest morphed value,
+        // each in its own gesture, and returns how many that was.
+        int pushToHost() {
+            JUCE_ASSERT_MESSAGE_THREAD
+            int pushed = 0;
+            hostPending.exchangeAndClear().forEachDirty ([&] (std::size_t i) {
+                if (auto* parameter = handles.handle (i).parameter) {
+                    parameter->beginChangeGesture();
+                    parameter->setValueNotifyingHost (hostValues[i].load (std::memory_order_relaxed));
+                    parameter->endChangeGesture();
+                    ++pushed;
+                }
+            });
+            return pushed;
+        }
+
+    private:
+        // Smaller moves than this are not worth a host notification
+        static constexpr float tolerance = 1.0e-6f;
+
+        float read (std::size_t index) const noexcept {
+            const auto* value = handles.handle (index).value;
+            return value != nullptr ? value->load (std::memory_order_relaxed) : 0.0f;
+        }
+
+        void publish() {
+            JUCE_ASSERT_MESSAGE_THREAD
+            std::copy (editing.begin(), editing.end(), banks.getWriteBuffer().begin());
+            banks.publish();
+        }
+
+        const ParameterHandleCache<Registry>& handles;
+
+        std::vector<float>               editing;
+        TripleBuffer<std::vector<float>> banks;
+
+        std::array<std::atomic<float>, MaxSnapshots>  weights;
+        std::array<float, numParameters>              blended {};
+        std::array<float, numParameters>              applied {};
+        std::array<bool, numParameters>               discrete {};
+        std::array<float, numParameters>              morphed {};
+        bool                                          followingParameters = true;
+
+        // Latest normalised value per parameter for pushToHost()
+        std::array<std::atomic<float>, numParameters> hostValues {};
+        ParameterDirtyMask<numParameters>             hostPending;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PresetMorpher)
+    };
+}
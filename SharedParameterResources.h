@@ -0,0 +1,126 @@
+#pragma once
+
+#include "ParameterReferences.h"
+
+#include <map>
+
+namespace moiraesoftware {
+
+    /*
+    Parameter ranges, lookup tables, formatter sets and choice lists shared by every plug-in instance in the
+    process. A host that loads a hundred instances otherwise builds a hundred identical copies of each: the
+    PowerLookupTables behind logarithmicThenLinearRangeLUT alone are about 2 kB per range.
+
+    Hold it through SharedParameterResourcesPointer, which creates the store for the first instance and deletes
+    it with the last. Everything handed out is immutable once built. References returned by the getters stay
+    valid while the pointer is held; parameters keep what they copied from them, so the store may go before
+    they do.
+
+        static juce::AudioProcessorValueTreeState::ParameterLayout createLayout (SharedParameterResources& shared) {
+            juce::AudioProcessorValueTreeState::ParameterLayout layout;
+            makeDBParam<gainID> ("Gain", shared.logarithmicThenLinearRangeLUT (-60.0f, 12.0f, 0.0f), 0.0f) (layout);
+            addToLayout<juce::AudioParameterChoice> (layout, modeID, "Mode", shared.getChoices ("modes", [] {
+                return juce::StringArray { "Clean", "Warm", "Crunch" };
+            }), 0);
+            return layout;
+        }
+
+        SharedParameterResourcesPointer sharedResources;   // processor member, before the APVTS
+        juce::AudioProcessorValueTreeState apvts { *this, nullptr, "state", createLayout (*sharedResources) };
+
+    The getters lock and may allocate, so call them while building layouts, not from the audio thread. They are
+    safe to call from instances being constructed on different threads.
+    */
+    class SharedParameterResources {
+    public:
+        SharedParameterResources() = default;
+
+        // One table per power for the whole process
+        [[nodiscard]] std::shared_ptr<const PowerLookupTable> getPowerTable (float power) {
+            const juce::ScopedLock sl (lock);
+            auto& table = powerTables[power];
+            if (table == nullptr)
+                table = std::make_shared<const PowerLookupTable> (power);
+            return table;
+        }
+
+        // logarithmicThenLinearRange, built once per set of arguments
+        [[nodiscard]] const juce::NormalisableRange<float>& logarithmicThenLinearRange (
+            float start,
+            float end,
+            float zeroPoint,
+            float breakpointOnSlider = defaultLogBreakpointOnSlider,
+            float exponent           = defaultLogExponent) {
+            return getRange ({ start, end, zeroPoint, breakpointOnSlider, exponent, false }, [&] {
+                return moiraesoftware::logarithmicThenLinearRange (start, end, zeroPoint, breakpointOnSlider, exponent);
+            });
+        }
+
+        // logarithmicThenLinearRangeLUT over the shared power tables
+        [[nodiscard]] const juce::NormalisableRange<float>& logarithmicThenLinearRangeLUT (
+            float start,
+            float end,
+            float zeroPoint,
+            float breakpointOnSlider = defaultLogBreakpointOnSlider,
+            float exponent           = defaultLogExponent) {
+            return getRange ({ start, end, zeroPoint, breakpointOnSlider, exponent, true }, [&] {
+                jassert (exponent > 0.0f);
+                return logarithmicThenLinearRangeFromTables (start,
+                                                             end,
+                                                             zeroPoint,
+                                                             breakpointOnSlider,
+                                                             getPowerTable (1.0f / exponent),
+                                                             getPowerTable (exponent));
+            });
+        }
+
+        // A choice list built by build() the first time key is asked for. juce::String is reference counted, so
+        // an AudioParameterChoice made from it shares the text instead of holding its own copy.
+        template <typename Build>
+        [[nodiscard]] const juce::StringArray& getChoices (std::string_view key, Build&& build) {
+            const juce::ScopedLock sl (lock);
+            if (const auto it = choices.find (key); it != choices.end())
+                return it->second;
+            return choices.emplace (std::string (key), build()).first->second;
+        }
+
+        // Formatters with captured state, e.g. makeStringFromValueWithOffAt, built once per key
+        template <typename Build>
+        [[nodiscard]] const juce::AudioParameterFloatAttributes& getFloatAttributes (std::string_view key, Build&& build) {
+            const juce::ScopedLock sl (lock);
+            if (const auto it = floatAttributes.find (key); it != floatAttributes.end())
+                return it->second;
+            return floatAttributes.emplace (std::string (key), build()).first->second;
+        }
+
+    private:
+        struct RangeKey {
+            float start, end, zeroPoint, breakpointOnSlider, exponent;
+            bool  lookupTables;
+
+            bool operator< (const RangeKey& other) const noexcept {
+                return std::tie (start, end, zeroPoint, breakpointOnSlider, exponent, lookupTables)
+                       < std::tie (other.start, other.end, other.zeroPoint, other.breakpointOnSlider, other.exponent, other.lookupTables);
+            }
+        };
+
+        template <typename Build>
+        const juce::NormalisableRange<float>& getRange (const RangeKey& key, Build&& build) {
+            // CriticalSection is re-entrant, so build() may take the lock again through getPowerTable
+            const juce::ScopedLock sl (lock);
+            if (const auto it = ranges.find (key); it != ranges.end())
+                return it->second;
+            return ranges.emplace (key, build()).first->second;
+        }
+
+        juce::CriticalSection                                                   lock;
+        std::map<float, std::shared_ptr<const PowerLookupTable>>                powerTables;
+        std::map<RangeKey, juce::NormalisableRange<float>>                      ranges;
+        std::map<std::string, juce::StringArray, std::less<>>                   choices;
+        std::map<std::string, juce::AudioParameterFloatAttributes, std::less<>> floatAttributes;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SharedParameterResources)
+    };
+
+    using SharedParameterResourcesPointer = juce::SharedResourcePointer<SharedParameterResources>;
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <bit>
+#include <unordered_map>
+
+namespace moiraesoftware {
+
+    /*
+    Compact binary state for APVTS-based processors: normalised parameter values by index, plus the parameter
+    ids so a snapshot saved by another version of the plug-in still restores by id.
+
+    Layout, little endian:
+        uint32  magic "MPHS"
+        uint16  version
+        uint16  reserved, 0
+        uint32  number of parameters
+        uint32  size of the id table in bytes
+        id table: per parameter, uint16 length then that many bytes of UTF-8
+        float   normalised value per parameter, in id table order
+
+    Saving copies the id table, which is built once, and writes one float per parameter. Restoring a snapshot
+    with an identical id table is a straight loop over the values; otherwise ids are matched by name, unknown
+    ones are skipped and parameters missing from the snapshot go back to their defaults. Data that is not a
+    snapshot is handed to the APVTS as the XML that copyXmlToBinary writes, so state saved before switching
+    formats still loads.
+
+    Only parameter values are stored. Keep using the XML state for anything else kept in the APVTS tree.
+
+        void getStateInformation (juce::MemoryBlock& destData) override { snapshot.save (destData); }
+        void setStateInformation (const void* data, int size) override { snapshot.restore (data, (size_t) size); }
+    */
+    class StateSnapshot {
+    public:
+        static constexpr std::uint32_t magic   = 0x5348504d; // "MPHS" in little endian
+        static constexpr std::uint16_t version = 1;
+
+        explicit StateSnapshot (juce::AudioProcessorValueTreeState& stateIn) : state (stateIn) {
+            for (auto* p : state.processor.getParameters())
+                if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*> (p))
+                    parameters.push_back (ranged);
+
+            juce::MemoryOutputStream table (idTable, false);
+            for (auto* p : parameters) {
+                const auto id     = p->paramID.toRawUTF8();
+                const auto length = static_cast<std::uint16_t> (p->paramID.getNumBytesAsUTF8());
+                table.writeShort (static_cast<short> (length));
+                table.write (id, length);
+            }
+        }
+
+        void save (juce::MemoryBlock& destData) const {
+            const auto numParameters = parameters.size();
+            destData.setSize (headerSize + idTable.getSize() + numParameters * sizeof (float));
+
+            auto* out = static_cast<char*> (destData.getData());
+            out       = write (out, magic);
+            out       = write (out, version);
+            out       = write (out, std::uint16_t { 0 });
+            out       = write (out, static_cast<std::uint32_t> (numParameters));
+            out       = write (out, static_cast<std::uint32_t> (idTable.getSize()));
+
+            if (idTable.getSize() > 0) {
+                std::memcpy (out, idTable.getData(), idTable.getSize());
+                out += idTable.getSize();
+            }
+
+            for (auto* p : parameters)
+                out = write (out, std::bit_cast<std::uint32_t> (p->getValue()));
+        }
+
+        // false when the data is neither a snapshot nor XML state for this APVTS
+        bool restore (const void* data, std::size_t size) {
+            if (isSnapshot (data, size))
+                return restoreSnapshot (static_cast<const char*> (data), size);
+
+            if (const auto xml = juce::AudioProcessor::getXmlFromBinary (data, static_cast<int> (size)))
+                if (xml->hasTagName (state.state.getType())) {
+                    state.replaceState (juce::ValueTree::fromXml (*xml));
+                    return true;
+                }
+
+            return false;
+        }
+
+        static bool isSnapshot (const void* data, std::size_t size) noexcept {
+            return data != nullptr && size >= headerSize && read<std::uint32_t> (static_cast<const char*> (data)) == magic;
+        }
+
+    private:
+        static constexpr std::size_t headerSize = 16;
+
+        template <typename T>
+        static char* write (char* out, T value) noexcept {
+            value = juce::ByteOrder::swapIfBigEndian (value);
+            std::memcpy (out, &value, sizeof (T));
+            return out + sizeof (T);
+        }
+
+        template <typename T>
+        static T read (const char* in) noexcept {
+            T value;
+            std::memcpy (&value, in, sizeof (T));
+            return juce::ByteOrder::swapIfBigEndian (value);
+        }
+
+        static float readValue (const char* values, std::size_t index) noexcept {
+            return std::bit_cast<float> (read<std::uint32_t> (values + index * sizeof (float)));
+        }
+
+        static void setIfChanged (juce::RangedAudioParameter& p, float value) {
+            value = juce::jlimit (0.0f, 1.0f, value);
+            if (!juce::exactlyEqual (p.getValue(), value))
+                p.setValueNotifyingHost (value);
+        }
+
+        bool restoreSnapshot (const char* data, std::size_t size) {
+            if (read<std::uint16_t> (data + 4) > version)
+                return false;
+
+            const auto numStored = static_cast<std::size_t> (read<std::uint32_t> (data + 8));
+            const auto tableSize = static_cast<std::size_t> (read<std::uint32_t> (data + 12));
+
+            if (size < headerSize + tableSize || (size - headerSize - tableSize) / sizeof (float) < numStored)
+                return false;
+
+            const auto* table  = data + headerSize;
+            const auto* values = table + tableSize;
+
+            // Same parameters in the same order: the common case, restored without looking at ids
+            if (numStored == parameters.size() && tableSize == idTable.getSize()
+                && (tableSize == 0 || std::memcmp (table, idTable.getData(), tableSize) == 0)) {
+                for (std::size_t i = 0; i < numStored; ++i)
+                    setIfChanged (*parameters[i], readValue (values, i));
+                return true;
+            }
+
+            // Saved by a different version of the plug-in, match by id
+            if (indexById.empty())
+                for (std::size_t i = 0; i < parameters.size(); ++i)
+                    indexById.emplace (parameters[i]->paramID.toStdString(), i);
+
+            std::vector<bool> restored (parameters.size(), false);
+            std::size_t       offset = 0;
+
+            for (std::size_t stored = 0; stored < numStored; ++stored) {
+                if (offset + sizeof (std::uint16_t) > tableSize)
+                    return false;
+
+                const auto length = static_cast<std::size_t> (read<std::uint16_t> (table + offset));
+                offset += sizeof (std::uint16_t);
+
+                if (offset + length > tableSize)
+                    return false;
+
+                if (const auto it = indexById.find (std::string_view (table + offset, length)); it != indexById.end()) {
+                    setIfChanged (*parameters[it->second], readValue (values, stored));
+                    restored[it->second] = true;
+                }
+
+                offset += length;
+            }
+
+            for (std::size_t i = 0; i < parameters.size(); ++i)
+                if (!restored[i])
+                    setIfChanged (*parameters[i], parameters[i]->getDefaultValue());
+
+            return true;
+        }
+
+        struct StringHash {
+            using is_transparent = void;
+            std::size_t operator() (std::string_view s) const noexcept { return std::hash<std::string_view> {}(s); }
+        };
+
+        juce::AudioProcessorValueTreeState&       state;
+        std::vector<juce::RangedAudioParameter*>  parameters;
+        juce::MemoryBlock                         idTable;
+        std::unordered_map<std::string, std::size_t, StringHash, std::equal_to<>> indexById;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (StateSnapshot)
+    };
+}
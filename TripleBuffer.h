@@ -0,0 +1,59 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+namespace moiraesoftware {
+
+    /*
+    Hands a value of T from one writer thread to one reader thread without either side ever waiting.
+
+    The writer fills getWriteBuffer() completely and calls publish(), which swaps it into the middle slot. The
+    reader calls acquire() once per block, which swaps the middle slot for its own when something was published
+    since, and reads from the result until the next acquire(). Only the latest publish is ever seen; intermediate
+    ones are skipped. The write buffer may hold data from two publishes ago, so it has to be overwritten in full.
+
+        TripleBuffer<std::vector<float>> table { std::vector<float> (size, 0.0f) };
+        std::copy (edited.begin(), edited.end(), table.getWriteBuffer().begin()); // message thread
+        table.publish();
+        ...
+        const auto& current = table.acquire();                                     // audio thread
+
+    Used by PresetMorpher for its snapshots and by ModulationMatrix for its routing.
+    */
+    template <typename T>
+    class TripleBuffer {
+    public:
+        TripleBuffer() = default;
+
+        // Every buffer starts as a copy of initial, e.g. to size vectors up front
+        explicit TripleBuffer (const T& initial) : buffers { initial, initial, initial } {}
+
+        // Writer side
+        [[nodiscard]] T& getWriteBuffer() noexcept { return buffers[writeIndex]; }
+
+        void publish() noexcept {
+            writeIndex = middle.exchange (writeIndex | dirtyBit, std::memory_order_acq_rel) & ~dirtyBit;
+        }
+
+        // Reader side. Picks up the latest publish, if any, and returns the buffer to read.
+        const T& acquire() noexcept {
+            if ((middle.load (std::memory_order_relaxed) & dirtyBit) != 0)
+                readIndex = middle.exchange (readIndex, std::memory_order_acq_rel) & ~dirtyBit;
+            return buffers[readIndex];
+        }
+
+        // Reader side. The buffer returned by the last acquire().
+        [[nodiscard]] const T& getReadBuffer() const noexcept { return buffers[readIndex]; }
+
+    private:
+        // Set in middle when it holds a publish the reader has not acquired yet
+        static constexpr std::uint32_t dirtyBit = 4;
+
+        std::array<T, 3>           buffers {};
+        std::uint32_t              writeIndex = 0;
+        std::atomic<std::uint32_t> middle { 1 };
+        std::uint32_t              readIndex = 2;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (TripleBuffer)
+    };
+}
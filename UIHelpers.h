@@ -5,6 +5,12 @@
 #include <juce_dsp/juce_dsp.h>
 #include <juce_gui_basics/juce_gui_basics.h>
 
+#include "ParameterUpdateDispatcher.h"
+#include "GestureCoalescer.h"
+
+#include <unordered_map>
+#include <variant>
+
 namespace moiraesoftware {
 
     inline juce::Rectangle<int>
@@ -23,7 +29,9 @@ namespace moiraesoftware {
         return { x, y, tileWidth, tileHeight };
     }
 
-    enum class RadioButtonParameterType { IndexBased, ComponentIdBased };
+    // IndexBased: button i sets the value i. ComponentIdBased: each button's name, read as a float when the button
+    // is added, is its value. ValueBased: values are given explicitly alongside the buttons.
+    enum class RadioButtonParameterType { IndexBased, ComponentIdBased, ValueBased };
 
     /*
 To implement a new attachment type, create a new class which includes an instance of this class as a data member.
@@ -36,32 +44,50 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
     class RadioButtonParameterAttachment : juce::Button::Listener {
     public:
         //     Creates a connection between a plug-in parameter and some radio buttons.
+        //     With a dispatcher, updates from other threads are applied once per frame instead of one async call each.
         RadioButtonParameterAttachment (juce::RangedAudioParameter&       param,
                                         const juce::Array<juce::Button*>& _buttons,
                                         const int                         groupID,
                                         juce::UndoManager*                undoManager,
-                                        const RadioButtonParameterType type = RadioButtonParameterType::IndexBased) :
+                                        const RadioButtonParameterType type = RadioButtonParameterType::IndexBased,
+                                        ParameterUpdateDispatcher*     dispatcher = nullptr) :
             storedParameter (param),
             attachment (
                 param,
                 [this] (const float newValue) { setValue (newValue); },
-                undoManager),
+                undoManager,
+                dispatcher),
+            radioGroupId (groupID),
             radioButtonType (type) {
-            for (int i = 0; i < _buttons.size(); ++i) {
-                auto button = _buttons.getUnchecked (i);
-                if (!buttons.contains (button)) {
-                    if (groupID > 0) {
-                        button->setRadioGroupId (groupID);
-                    }
-                    button->setClickingTogglesState (true);
-                    buttons.add (button);
-                    button->addListener (this);
-                }
-            }
+            jassert (type != RadioButtonParameterType::ValueBased); // use the constructor that takes the values
+            for (auto* button : _buttons)
+                addButtonWithValue (button, static_cast<float> (buttons.size()));
+            attachment.sendInitialUpdate();
+        }
+
+        // Clicking buttons[i] sets the parameter to the plain value values[i]
+        RadioButtonParameterAttachment (juce::RangedAudioParameter&       param,
+                                        const juce::Array<juce::Button*>& _buttons,
+                                        const juce::Array<float>&         values,
+                                        const int                         groupID,
+                                        juce::UndoManager*                undoManager,
+                                        ParameterUpdateDispatcher*        dispatcher = nullptr) :
+            storedParameter (param),
+            attachment (
+                param,
+                [this] (const float newValue) { setValue (newValue); },
+                undoManager,
+                dispatcher),
+            radioGroupId (groupID),
+            radioButtonType (RadioButtonParameterType::ValueBased) {
+            jassert (_buttons.size() == values.size());
+            for (int i = 0; i < juce::jmin (_buttons.size(), values.size()); ++i)
+                addButtonWithValue (_buttons.getUnchecked (i), values.getUnchecked (i));
             attachment.sendInitialUpdate();
         }
 
         ~RadioButtonParameterAttachment() override {
+            setGestureCoalescer (nullptr);
             for (int i = 0; i < buttons.size(); ++i) {
                 juce::Button* button = buttons.getUnchecked (i);
                 button->removeListener (this);
@@ -83,66 +109,108 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
 
         [[nodiscard]] juce::RangedAudioParameter& getParam() const { return storedParameter; }
 
+        // Adds a button after construction. Its value is the next index, or its name for ComponentIdBased.
+        void addButton (juce::Button* button) {
+            jassert (radioButtonType != RadioButtonParameterType::ValueBased);
+            if (addButtonWithValue (button, static_cast<float> (buttons.size())))
+                setValue (value);
+        }
+
+        // Adds a button after construction to a ValueBased attachment
+        void addButton (juce::Button* button, float buttonValue) {
+            jassert (radioButtonType == RadioButtonParameterType::ValueBased);
+            if (addButtonWithValue (button, buttonValue))
+                setValue (value);
+        }
+
+        // The plain value a button sets, in button order
+        [[nodiscard]] float getButtonValue (const int index) const { return buttonValues[static_cast<std::size_t> (index)]; }
+
+        // Opts into merging rapid clicks into one undo transaction and host gesture, nullptr to stop
+        void setGestureCoalescer (GestureCoalescer* newCoalescer) {
+            if (coalescer != nullptr)
+                coalescer->release (attachment);
+            coalescer = newCoalescer;
+        }
+
     private:
+        void setValueAsGesture (float newValue) {
+            if (coalescer != nullptr)
+                coalescer->setValue (attachment, newValue);
+            else
+                attachment.setValueAsCompleteGesture (newValue);
+        }
+
+        // Fills the button<->value tables as buttons arrive, so updates and clicks are lookups rather than scans
+        // of the buttons. Returns false for a button that was already added.
+        bool addButtonWithValue (juce::Button* button, float valueIfNotNamed) {
+            if (button == nullptr || indexOfButton.contains (button))
+                return false;
+
+            const auto buttonIndex = buttons.size();
+            const auto buttonValue = radioButtonType == RadioButtonParameterType::ComponentIdBased ? button->getName().getFloatValue()
+                                                                                                   : valueIfNotNamed;
+            if (radioGroupId > 0) {
+                button->setRadioGroupId (radioGroupId);
+            }
+            button->setClickingTogglesState (true);
+            buttons.add (button);
+            button->addListener (this);
+
+            buttonValues.push_back (buttonValue);
+            indexOfButton.emplace (button, buttonIndex);
+            indexOfValue.emplace (buttonValue, buttonIndex); // with duplicate values the first button wins
+            return true;
+        }
+
+        [[nodiscard]] int findButton (const juce::Button* b) const {
+            const auto it = indexOfButton.find (b);
+            return it != indexOfButton.end() ? it->second : -1;
+        }
+
         void setValueUsingIndex() {
             const juce::ScopedValueSetter<bool> svs (ignoreCallbacks, true);
-            auto                                button = buttons[static_cast<int> (value)];
-            button->setToggleState (true, juce::sendNotification);
+            if (auto button = buttons[static_cast<int> (value)])
+                button->setToggleState (true, juce::sendNotification);
         }
 
         void buttonClickUseIndex (juce::Button* b) {
-            for (int i = 0; i < buttons.size(); i++) {
-                if (b == buttons.getUnchecked (i) && b->getToggleState()) {
-                    //the value to set comes from the buttons index in the array 0-<no of buttons>
-                    const auto newValue = static_cast<float> (i);
-                    attachment.setValueAsCompleteGesture (newValue);
-                }
-            }
+            //the value to set comes from the buttons index in the array 0-<no of buttons>
+            if (const auto i = findButton (b); i >= 0 && b->getToggleState())
+                setValueAsGesture (static_cast<float> (i));
         }
 
-        void setValueUsingComponentId() {
+        void setValueUsingButtonValues() {
             const juce::ScopedValueSetter<bool> svs (ignoreCallbacks, true);
-            {
-                auto is_valueMatch = [this] (juce::Component::SafePointer<juce::Button> b) {
-                    const auto componentName            = b->getName();
-                    const auto buttonComponentNameValue = componentName.getFloatValue();
-                    const auto match                    = value == buttonComponentNameValue;
-                    return match;
-                };
-
-                auto matchedButton = std::find_if (buttons.begin(), buttons.end(), is_valueMatch);
-                if (matchedButton != std::end (buttons)) {
-                    auto component = matchedButton->getComponent();
-                    if (component) {
-                        component->setToggleState (true, juce::sendNotification);
-                    }
-                } else {
-                    //There is no match so toggle all buttons to off
-                    std::ranges::for_each (buttons, [this] (const juce::Component::SafePointer<juce::Button>& b) {
-                        b->setToggleState (false, juce::NotificationType::dontSendNotification);
-                    });
+            if (const auto it = indexOfValue.find (value); it != indexOfValue.end()) {
+                if (auto component = buttons[it->second].getComponent()) {
+                    component->setToggleState (true, juce::sendNotification);
                 }
+            } else {
+                //There is no match so toggle all buttons to off
+                std::ranges::for_each (buttons, [] (const juce::Component::SafePointer<juce::Button>& b) {
+                    if (b != nullptr)
+                        b->setToggleState (false, juce::NotificationType::dontSendNotification);
+                });
             }
         }
 
-        void buttonClickUseComponentId (juce::Button* b) {
-            for (int i = 0; i < buttons.size(); i++) {
-                if (b == buttons.getUnchecked (i) && b->getToggleState()) {
-                    //the value to set comes from the componentId for the button, yuck!  Alternatively we could use a tuple passed in with the
-                    // button, the second value in the tuple could be an enum with a value which is then cast to float, or just the float value.
-                    const auto newValue      = b->getName().getFloatValue();
-                    auto       existingValue = storedParameter.convertFrom0to1 (storedParameter.getValue());
-                    if (newValue != existingValue) {
-                        attachment.setValueAsCompleteGesture (newValue);
-                    } else {
-                        //if this is setting the value to what it was then we need to reset it to a known default, so we use the default value
-                        // for this.  We could assign a reset value if we ever need a default and reset.  This would onyl really be needed if
-                        // the default was say 3, and when you re-clicked this radio button you wanted it to goto 0 or another value.  We can
-                        // revisit this if needed...
-                        const auto defaultValue = storedParameter.getDefaultValue();
-                        attachment.setValueAsCompleteGesture (defaultValue);
-                    }
-                }
+        void buttonClickUseButtonValues (juce::Button* b) {
+            const auto i = findButton (b);
+            if (i < 0 || !b->getToggleState())
+                return;
+
+            const auto newValue      = buttonValues[static_cast<std::size_t> (i)];
+            auto       existingValue = storedParameter.convertFrom0to1 (storedParameter.getValue());
+            if (newValue != existingValue) {
+                setValueAsGesture (newValue);
+            } else {
+                //if this is setting the value to what it was then we need to reset it to a known default, so we use the default value
+                // for this.  We could assign a reset value if we ever need a default and reset.  This would onyl really be needed if
+                // the default was say 3, and when you re-clicked this radio button you wanted it to goto 0 or another value.  We can
+                // revisit this if needed...
+                const auto defaultValue = storedParameter.getDefaultValue();
+                setValueAsGesture (defaultValue);
             }
         }
 
@@ -154,7 +222,8 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
                     setValueUsingIndex();
                     break;
                 case RadioButtonParameterType::ComponentIdBased:
-                    setValueUsingComponentId();
+                case RadioButtonParameterType::ValueBased:
+                    setValueUsingButtonValues();
                     break;
             }
         }
@@ -168,7 +237,8 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
                     buttonClickUseIndex (b);
                     break;
                 case RadioButtonParameterType::ComponentIdBased:
-                    buttonClickUseComponentId (b);
+                case RadioButtonParameterType::ValueBased:
+                    buttonClickUseButtonValues (b);
                     break;
             }
         }
@@ -187,9 +257,14 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
 
         float                                                   value {};
         juce::RangedAudioParameter&                             storedParameter;
-        juce::ParameterAttachment                               attachment;
+        OptionallyBatchedParameterAttachment                    attachment;
         juce::Array<juce::Component::SafePointer<juce::Button>> buttons;
+        std::vector<float>                                      buttonValues;
+        std::unordered_map<const juce::Button*, int>            indexOfButton;
+        std::unordered_map<float, int>                          indexOfValue;
         bool                                                    ignoreCallbacks = false;
+        GestureCoalescer*                                       coalescer       = nullptr;
+        int                                                     radioGroupId;
         RadioButtonParameterType                                radioButtonType;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (RadioButtonParameterAttachment)
@@ -244,17 +319,11 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
         }
 
         static SuffixStrategy hideAtMin(const juce::RangedAudioParameter& param) {
-            return [&param](float value, const juce::String& suffix) {
-                auto range = param.getNormalisableRange();
-                return juce::approximatelyEqual(value, range.start) ? "" : suffix.toStdString();
-            };
+            return hideAt(param.getNormalisableRange().start);
         }
 
         static SuffixStrategy hideAtMax(const juce::RangedAudioParameter& param) {
-            return [&param](float value, const juce::String& suffix) {
-                auto range = param.getNormalisableRange();
-                return juce::approximatelyEqual(value, range.end) ? "" : suffix.toStdString();
-            };
+            return hideAt(param.getNormalisableRange().end);
         }
 
         static SuffixStrategy hideAtZero() {
@@ -277,35 +346,109 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
         //   - No hardcoded 19.0f anywhere!
 
         static SuffixStrategy offAtMin(const juce::RangedAudioParameter& param, const std::string& unit = "") {
-            return [&param, unit](float value, const juce::String& defaultSuffix) {
-                auto range = param.getNormalisableRange();
-                if (juce::approximatelyEqual(value, range.start)) {
-                    return std::string("OFF");
-                }
-                return unit.empty() ? defaultSuffix.toStdString() : unit;
-            };
+            return offAt(param.getNormalisableRange().start, unit);
         }
 
         static SuffixStrategy offAtMax(const juce::RangedAudioParameter& param, const std::string& unit = "") {
-            return [&param, unit](float value, const juce::String& defaultSuffix) {
-                auto range = param.getNormalisableRange();
-                if (juce::approximatelyEqual(value, range.end)) {
-                    return std::string("OFF");
-                }
-                return unit.empty() ? defaultSuffix.toStdString() : unit;
-            };
+            return offAt(param.getNormalisableRange().end, unit);
         }
 
         // Convenience factory for frequency parameters with OFF states
         static SuffixStrategy frequencyWithOff(const juce::RangedAudioParameter& param, bool offAtMinimum = true) {
             return offAtMinimum ? offAtMin(param, "Hz") : offAtMax(param, "Hz");
         }
+
+    private:
+        // The range end is read once here rather than on every update
+        static SuffixStrategy offAt(float offValue, const std::string& unit) {
+            return [offValue, unit](float value, const juce::String& defaultSuffix) {
+                if (juce::approximatelyEqual(value, offValue)) {
+                    return std::string("OFF");
+                }
+                return unit.empty() ? defaultSuffix.toStdString() : unit;
+            };
+        }
     };
 
+    /*
+    Compile-time counterparts of SuffixStrategies. Each policy is a plain struct that AttachedSlider visits
+    directly, so the check inlines instead of going through a std::function. Range ends are read when the policy
+    is made, and the result is a view of the policy's own text or of the default suffix, so working out the
+    suffix for a new slider value never allocates.
+
+    Example, the lowcut filter from above:
+      AttachedSlider(editor, lowCutParam, undoManager, SuffixPolicies::frequencyWithOff(lowCutParam, true))
+    */
+    namespace SuffixPolicies {
+        struct Always {
+            std::string_view operator() (float, std::string_view defaultSuffix) const noexcept { return defaultSuffix; }
+        };
+
+        struct Never {
+            std::string_view operator() (float, std::string_view) const noexcept { return {}; }
+        };
+
+        struct HideAt {
+            float hideValue = 0.0f;
+
+            std::string_view operator() (float value, std::string_view defaultSuffix) const noexcept {
+                return juce::approximatelyEqual (value, hideValue) ? std::string_view() : defaultSuffix;
+            }
+        };
+
+        struct OffAt {
+            float       offValue = 0.0f;
+            std::string unit;    // empty means the default suffix
+            std::string offText = "OFF";
+
+            std::string_view operator() (float value, std::string_view defaultSuffix) const noexcept {
+                if (juce::approximatelyEqual (value, offValue))
+                    return offText;
+                return unit.empty() ? defaultSuffix : std::string_view (unit);
+            }
+        };
+
+        // Adapts a SuffixStrategy, keeping its std::function call and string per update
+        struct Custom {
+            explicit Custom (SuffixStrategy strategyIn) : strategy (std::move (strategyIn)) {}
+
+            std::string_view operator() (float value, std::string_view defaultSuffix) const {
+                text = strategy (value, juce::String::fromUTF8 (defaultSuffix.data(), static_cast<int> (defaultSuffix.size())));
+                return text;
+            }
+
+            SuffixStrategy      strategy;
+            mutable std::string text;
+        };
+
+        inline HideAt hideAt (float hideValue) { return { hideValue }; }
+        inline HideAt hideAtZero() { return { 0.0f }; }
+        inline HideAt hideAtMin (const juce::RangedAudioParameter& param) { return { param.getNormalisableRange().start }; }
+        inline HideAt hideAtMax (const juce::RangedAudioParameter& param) { return { param.getNormalisableRange().end }; }
+
+        inline OffAt offAtMin (const juce::RangedAudioParameter& param, std::string unit = {}) {
+            return { param.getNormalisableRange().start, std::move (unit) };
+        }
+
+        inline OffAt offAtMax (const juce::RangedAudioParameter& param, std::string unit = {}) {
+            return { param.getNormalisableRange().end, std::move (unit) };
+        }
+
+        inline OffAt frequencyWithOff (const juce::RangedAudioParameter& param, bool offAtMinimum = true) {
+            return offAtMinimum ? offAtMin (param, "Hz") : offAtMax (param, "Hz");
+        }
+    }
+
+    using SuffixPolicy = std::variant<SuffixPolicies::Always,
+                                      SuffixPolicies::Never,
+                                      SuffixPolicies::HideAt,
+                                      SuffixPolicies::OffAt,
+                                      SuffixPolicies::Custom>;
+
     // Legacy enum for backwards compatibility
     enum SuffixDisplay { OffOnMinimum, OffOnMaximum, Always, Never, Zero };
 
-    class AttachedSlider : public ComponentWithParamMenu {
+    class AttachedSlider : public ComponentWithParamMenu, private ParameterUpdateDispatcher::FrameListener {
     public:
         // Legacy constructor for backwards compatibility
         AttachedSlider (juce::AudioProcessorEditor& editorIn,
@@ -317,7 +460,7 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
             ComponentWithParamMenu (editorIn, paramIn),
             slider { style, juce::Slider::TextBoxBelow },
             label ("", paramIn.name),
-            attachment (paramIn, slider, undoManager),
+            attachment (std::in_place, paramIn, slider, undoManager),
             suffixDisplay (suffix),
             useLegacySuffix(true) {
             initializeSlider(showLabel);
@@ -333,14 +476,60 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
             ComponentWithParamMenu (editorIn, paramIn),
             slider { style, juce::Slider::TextBoxBelow },
             label ("", paramIn.name),
-            attachment (paramIn, slider, undoManager),
-            suffixStrategy (std::move(suffixStrategy)),
+            attachment (std::in_place, paramIn, slider, undoManager),
+            suffixPolicy (fromStrategy (std::move(suffixStrategy))),
             useLegacySuffix(false) {
             initializeSlider(showLabel);
         }
 
+        // Constructor taking one of the SuffixPolicies
+        AttachedSlider (juce::AudioProcessorEditor& editorIn,
+                        juce::RangedAudioParameter& paramIn,
+                        juce::UndoManager*          undoManager,
+                        SuffixPolicy                suffixPolicyIn,
+                        juce::Slider::SliderStyle   style     = juce::Slider::RotaryVerticalDrag,
+                        bool                        showLabel = false) :
+            ComponentWithParamMenu (editorIn, paramIn),
+            slider { style, juce::Slider::TextBoxBelow },
+            label ("", paramIn.name),
+            attachment (std::in_place, paramIn, slider, undoManager),
+            suffixPolicy (std::move(suffixPolicyIn)),
+            useLegacySuffix(false) {
+            initializeSlider(showLabel);
+        }
+
+        // Opts into frame-batched updates through the editor's dispatcher instead of an async update per change
+        AttachedSlider (juce::AudioProcessorEditor& editorIn,
+                        juce::RangedAudioParameter& paramIn,
+                        juce::UndoManager*          undoManager,
+                        ParameterUpdateDispatcher&  dispatcher,
+                        SuffixPolicy                suffixPolicyIn = {},
+                        juce::Slider::SliderStyle   style     = juce::Slider::RotaryVerticalDrag,
+                        bool                        showLabel = false) :
+            ComponentWithParamMenu (editorIn, paramIn),
+            slider { style, juce::Slider::TextBoxBelow },
+            label ("", paramIn.name),
+            batchedAttachment (std::in_place, dispatcher, paramIn, slider, undoManager),
+            suffixPolicy (std::move(suffixPolicyIn)),
+            useLegacySuffix(false) {
+            initializeSlider(showLabel);
+        }
+
+        ~AttachedSlider() override { hideModulatedValue(); }
+
     private:
+        static SuffixPolicy fromStrategy (SuffixStrategy strategy) {
+            if (strategy)
+                return SuffixPolicies::Custom { std::move (strategy) };
+            return SuffixPolicies::Always {};
+        }
+
         void initializeSlider(bool showLabel) {
+            // Fixed for the lifetime of the slider, so read once rather than on every update
+            defaultSuffix = getParam().label.toStdString();
+            rangeStart    = slider.getMinimum();
+            rangeEnd      = slider.getMaximum();
+
             slider.addMouseListener (this, true);
             addAndMakeVisible (slider);
 
@@ -365,10 +554,10 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
 
     private:
         void updateLegacySuffix() {
-            const auto value  = slider.getValueObject();
-            const bool isMin  = value == slider.getMinimum();
-            const bool isMax  = value == slider.getMaximum();
-            const bool isZero = juce::approximatelyEqual (static_cast<float> (value.getValue()), 0.0f);
+            const auto value  = slider.getValue();
+            const bool isMin  = juce::exactlyEqual (value, rangeStart);
+            const bool isMax  = juce::exactlyEqual (value, rangeEnd);
+            const bool isZero = juce::approximatelyEqual (static_cast<float> (value), 0.0f);
 
             if ((suffixDisplay == OffOnMinimum && isMin) || (suffixDisplay == OffOnMaximum && isMax)
                 || (suffixDisplay == Never) || (suffixDisplay == Zero && isZero)) {
@@ -379,13 +568,22 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
         }
 
         void updateModernSuffix() {
-            if (suffixStrategy) {
-                auto currentValue = static_cast<float>(slider.getValue());
-                auto suffixText = suffixStrategy(currentValue, getParam().label);
-                slider.setTextValueSuffix(suffixText.empty() ? "" : " " + juce::String(suffixText));
-            } else {
-                SetDefaultSuffix();
-            }
+            const auto currentValue = static_cast<float>(slider.getValue());
+            showSuffix (std::visit ([this, currentValue] (const auto& policy) {
+                return std::string_view (policy (currentValue, defaultSuffix));
+            }, suffixPolicy));
+        }
+
+        // setTextValueSuffix re-lays-out and repaints the text box, so it is only called when the text changes,
+        // e.g. when the value crosses into "OFF"
+        void showSuffix (std::string_view suffix) {
+            if (hasDisplayedSuffix && suffix == displayedSuffix)
+                return;
+
+            hasDisplayedSuffix = true;
+            displayedSuffix.assign (suffix);
+            slider.setTextValueSuffix (suffix.empty() ? juce::String()
+                                                      : " " + juce::String::fromUTF8 (suffix.data(), static_cast<int> (suffix.size())));
         }
 
     public:
@@ -403,31 +601,114 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
             // The parameter factories (makeMsParam, makeDBParam, makeFrequencyParam, ...) already embed
             // the unit in textFromValueFunction. Appending a non-empty default suffix doubles it
             // (e.g. "10 ms" + "ms" => "10 msms"). Only honour the JUCE param label when it is set.
-            const auto& label = getParam().label;
-            slider.setTextValueSuffix (label.isEmpty() ? juce::String() : " " + label);
+            showSuffix (defaultSuffix);
         }
 
-        void ClearSuffix() { slider.setTextValueSuffix (""); }
+        void ClearSuffix() { showSuffix ({}); }
 
         void resized() override { slider.setBounds (getLocalBounds()); }
 
         juce::Slider& getSlider() { return slider; }
         juce::Label& getLabel() { return label; }
 
-        juce::SliderParameterAttachment& getAttachment() { return attachment; }
+        // Only for sliders constructed without a dispatcher
+        juce::SliderParameterAttachment& getAttachment() {
+            jassert (attachment.has_value());
+            return *attachment;
+        }
+
+        [[nodiscard]] bool isBatched() const noexcept { return batchedAttachment.has_value(); }
+
+        // Marks the modulated value next to the parameter's own, e.g. from ModulationMatrix::getDisplayValue.
+        // The value is polled by the editor's dispatcher once per frame, with every other control, and only the
+        // marker's old and new areas are repainted when it moves. source must outlive the slider or be hidden first.
+        void showModulatedValue (ParameterUpdateDispatcher& dispatcher, const std::atomic<float>& source) {
+            hideModulatedValue();
+            modulationSource     = &source;
+            modulationDispatcher = &dispatcher;
+            modulationDispatcher->addFrameListener (*this);
+            frameUpdate();
+        }
+
+        void hideModulatedValue() {
+            if (modulationDispatcher != nullptr)
+                modulationDispatcher->removeFrameListener (*this);
+
+            modulationDispatcher = nullptr;
+            modulationSource     = nullptr;
+
+            if (shownModulation.has_value())
+                repaint (getMarkerArea (*shownModulation).getSmallestIntegerContainer().expanded (1));
+            shownModulation.reset();
+        }
+
+        void paintOverChildren (juce::Graphics& g) override {
+            if (!shownModulation.has_value())
+                return;
+
+            g.setColour (slider.findColour (juce::Slider::thumbColourId).withAlpha (0.8f));
+
+            if (slider.isRotary())
+                g.fillEllipse (getMarkerArea (*shownModulation));
+            else
+                g.fillRect (getMarkerArea (*shownModulation));
+        }
 
     private:
+        void frameUpdate() override {
+            const auto proportion = slider.valueToProportionOfLength (modulationSource->load (std::memory_order_relaxed));
+
+            // Well under a pixel on any slider, so a held value or an unrouted parameter costs nothing per frame
+            if (shownModulation.has_value() && std::abs (*shownModulation - proportion) < 1.0 / 1024.0)
+                return;
+
+            if (shownModulation.has_value())
+                repaint (getMarkerArea (*shownModulation).getSmallestIntegerContainer().expanded (1));
+            shownModulation = proportion;
+            repaint (getMarkerArea (proportion).getSmallestIntegerContainer().expanded (1));
+        }
+
+        // A dot on the arc of a rotary slider, a line across the track of a linear one
+        juce::Rectangle<float> getMarkerArea (double proportion) const {
+            if (slider.isRotary()) {
+                const auto area   = slider.getBounds().withTrimmedBottom (slider.getTextBoxHeight()).toFloat();
+                const auto params = slider.getRotaryParameters();
+                const auto angle  = params.startAngleRadians + static_cast<float> (proportion) * (params.endAngleRadians - params.startAngleRadians);
+                const auto radius = juce::jmax (0.0f, juce::jmin (area.getWidth(), area.getHeight()) * 0.5f - 3.0f);
+                return juce::Rectangle<float> (5.0f, 5.0f).withCentre (area.getCentre().getPointOnCircumference (radius, angle));
+            }
+
+            const auto position = slider.getPositionOfValue (slider.proportionOfLengthToValue (proportion));
+            const auto bounds   = slider.getBounds().toFloat();
+            if (slider.isHorizontal())
+                return { bounds.getX() + position - 1.0f, bounds.getY(), 2.0f, bounds.getHeight() };
+            return { bounds.getX(), bounds.getY() + position - 1.0f, bounds.getWidth(), 2.0f };
+        }
+
         juce::Slider                    slider;
         juce::Label                     label;
-        juce::SliderParameterAttachment attachment;
+        std::optional<juce::SliderParameterAttachment>  attachment;
+        std::optional<BatchedSliderParameterAttachment> batchedAttachment;
 
         // Legacy suffix system
         SuffixDisplay                   suffixDisplay = Always;
 
         // Modern suffix system
-        SuffixStrategy                  suffixStrategy;
+        SuffixPolicy                    suffixPolicy;
         bool                            useLegacySuffix = true;
 
+        // What the text box currently shows, to skip redundant setTextValueSuffix calls
+        std::string                     defaultSuffix;
+        std::string                     displayedSuffix;
+        bool                            hasDisplayedSuffix = false;
+        double                          rangeStart = 0.0;
+        double                          rangeEnd   = 0.0;
+
+        // Modulation marker, as a proportion of the slider's length
+        const std::atomic<float>*  modulationSource     = nullptr;
+        ParameterUpdateDispatcher* modulationDispatcher = nullptr;
+        std::optional<double>      shownModulation;
+
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AttachedSlider)
     };
 
@@ -436,7 +717,17 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
         AttachedToggle (juce::AudioProcessorEditor& editorIn, juce::RangedAudioParameter& paramIn) :
             ComponentWithParamMenu (editorIn, paramIn),
             toggleButton (paramIn.name),
-            attachment (paramIn, toggleButton) {
+            attachment (std::in_place, paramIn, toggleButton) {
+            toggleButton.addMouseListener (this, true);
+            addAndMakeVisible (toggleButton);
+        }
+
+        AttachedToggle (juce::AudioProcessorEditor& editorIn,
+                        juce::RangedAudioParameter& paramIn,
+                        ParameterUpdateDispatcher&  dispatcher) :
+            ComponentWithParamMenu (editorIn, paramIn),
+            toggleButton (paramIn.name),
+            batchedAttachment (std::in_place, dispatcher, paramIn, toggleButton) {
             toggleButton.addMouseListener (this, true);
             addAndMakeVisible (toggleButton);
         }
@@ -445,11 +736,18 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
 
         juce::ToggleButton& getToggle() { return toggleButton; }
 
-        juce::ButtonParameterAttachment& getAttachment() { return attachment; }
+        // Only for toggles constructed without a dispatcher
+        juce::ButtonParameterAttachment& getAttachment() {
+            jassert (attachment.has_value());
+            return *attachment;
+        }
+
+        [[nodiscard]] bool isBatched() const noexcept { return batchedAttachment.has_value(); }
 
     private:
-        juce::ToggleButton              toggleButton;
-        juce::ButtonParameterAttachment attachment;
+        juce::ToggleButton                              toggleButton;
+        std::optional<juce::ButtonParameterAttachment>  attachment;
+        std::optional<BatchedButtonParameterAttachment> batchedAttachment;
     };
 
     class AttachedRadioButtons : public ComponentWithParamMenu {
@@ -459,8 +757,24 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
                               juce::Array<juce::Button*>&    buttons,
                               const int                      groupId,
                               juce::UndoManager*             um,
-                              const RadioButtonParameterType radioType) :
-            ComponentWithParamMenu (editorIn, paramIn), attachment (paramIn, buttons, groupId, um, radioType) {
+                              const RadioButtonParameterType radioType,
+                              ParameterUpdateDispatcher*     dispatcher = nullptr) :
+            ComponentWithParamMenu (editorIn, paramIn), attachment (paramIn, buttons, groupId, um, radioType, dispatcher) {
+            std::ranges::for_each (buttons, [this] (juce::Button* b) {
+                b->addMouseListener (this, true);
+                addAndMakeVisible (b);
+            });
+        }
+
+        // ValueBased: clicking buttons[i] sets the parameter to values[i]
+        AttachedRadioButtons (juce::AudioProcessorEditor& editorIn,
+                              juce::RangedAudioParameter& paramIn,
+                              juce::Array<juce::Button*>& buttons,
+                              const juce::Array<float>&   values,
+                              const int                   groupId,
+                              juce::UndoManager*          um,
+                              ParameterUpdateDispatcher*  dispatcher = nullptr) :
+            ComponentWithParamMenu (editorIn, paramIn), attachment (paramIn, buttons, values, groupId, um, dispatcher) {
             std::ranges::for_each (buttons, [this] (juce::Button* b) {
                 b->addMouseListener (this, true);
                 addAndMakeVisible (b);
@@ -537,14 +851,19 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
             ComponentWithParamMenu (editorIn, paramIn),
             combo (paramIn),
             label ("", paramIn.name),
-            attachment (paramIn, combo, undoManager) {
-            combo.addMouseListener (this, true);
-            combo.setJustificationType (juce::Justification::centred);
-            addAndMakeVisible(combo);
-            addAndMakeVisible (label);
+            attachment (std::in_place, paramIn, combo, undoManager) {
+            initializeCombo();
+        }
 
-            label.attachToComponent (&combo, false);
-            label.setJustificationType (juce::Justification::centred);
+        AttachedCombo (juce::AudioProcessorEditor& editorIn,
+                       juce::RangedAudioParameter& paramIn,
+                       juce::UndoManager*          undoManager,
+                       ParameterUpdateDispatcher&  dispatcher) :
+            ComponentWithParamMenu (editorIn, paramIn),
+            combo (paramIn),
+            label ("", paramIn.name),
+            batchedAttachment (std::in_place, dispatcher, paramIn, combo, undoManager) {
+            initializeCombo();
         }
 
         void resized() override {
@@ -553,6 +872,16 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
         }
 
     private:
+        void initializeCombo() {
+            combo.addMouseListener (this, true);
+            combo.setJustificationType (juce::Justification::centred);
+            addAndMakeVisible(combo);
+            addAndMakeVisible (label);
+
+            label.attachToComponent (&combo, false);
+            label.setJustificationType (juce::Justification::centred);
+        }
+
         struct ComboWithItems final : public juce::ComboBox {
             explicit ComboWithItems (juce::RangedAudioParameter& param) {
                 // Adding the list here in the constructor means that the combo
@@ -561,13 +890,21 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
             }
         };
 
-        ComboWithItems                    combo;
-        juce::Label                       label;
-        juce::ComboBoxParameterAttachment attachment;
+        ComboWithItems                                    combo;
+        juce::Label                                       label;
+        std::optional<juce::ComboBoxParameterAttachment>  attachment;
+        std::optional<BatchedComboBoxParameterAttachment> batchedAttachment;
 
     public:
-        ComboWithItems&                    getCombo() { return combo; }
-        juce::ComboBoxParameterAttachment& getAttachment() { return attachment; }
+        ComboWithItems& getCombo() { return combo; }
+
+        // Only for combos constructed without a dispatcher
+        juce::ComboBoxParameterAttachment& getAttachment() {
+            jassert (attachment.has_value());
+            return *attachment;
+        }
+
+        [[nodiscard]] bool isBatched() const noexcept { return batchedAttachment.has_value(); }
     };
 
     // AttachedCycler: Reusable template for discrete parameter cycling with custom UI components
@@ -580,9 +917,60 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
                        std::function<void(float)> valueChangedCallback = nullptr,
                        std::function<uint32_t(uint32_t)> customCycleNext = nullptr,
                        std::function<uint32_t(uint32_t)> customCyclePrevious = nullptr)
+            : AttachedCycler(editorIn, paramIn, nullptr, undoManager, std::move(valueChangedCallback),
+                             std::move(customCycleNext), std::move(customCyclePrevious))
+        {
+        }
+
+        // Opts into frame-batched updates through the editor's dispatcher instead of an async update per change
+        AttachedCycler(juce::AudioProcessorEditor& editorIn,
+                       juce::RangedAudioParameter& paramIn,
+                       ParameterUpdateDispatcher& dispatcher,
+                       juce::UndoManager* undoManager = nullptr,
+                       std::function<void(float)> valueChangedCallback = nullptr,
+                       std::function<uint32_t(uint32_t)> customCycleNext = nullptr,
+                       std::function<uint32_t(uint32_t)> customCyclePrevious = nullptr)
+            : AttachedCycler(editorIn, paramIn, &dispatcher, undoManager, std::move(valueChangedCallback),
+                             std::move(customCycleNext), std::move(customCyclePrevious))
+        {
+        }
+
+        ~AttachedCycler() override {
+            setGestureCoalescer(nullptr);
+        }
+
+        void resized() override {
+            component.setBounds(getLocalBounds());
+        }
+
+        CustomComponent& getComponent() { return component; }
+
+        // Only for cyclers constructed without a dispatcher
+        juce::ParameterAttachment& getAttachment() { return attachment.getDirectAttachment(); }
+
+        // Either kind of attachment, behind the interface they share
+        OptionallyBatchedParameterAttachment& getOptionallyBatchedAttachment() { return attachment; }
+
+        [[nodiscard]] bool isBatched() const noexcept { return attachment.isBatched(); }
+
+        // Opts into merging rapid cycling into one undo transaction and host gesture, nullptr to stop
+        void setGestureCoalescer(GestureCoalescer* newCoalescer) {
+            if (coalescer != nullptr)
+                coalescer->release(attachment);
+            coalescer = newCoalescer;
+        }
+
+    private:
+        AttachedCycler(juce::AudioProcessorEditor& editorIn,
+                       juce::RangedAudioParameter& paramIn,
+                       ParameterUpdateDispatcher* dispatcher,
+                       juce::UndoManager* undoManager,
+                       std::function<void(float)> valueChangedCallback,
+                       std::function<uint32_t(uint32_t)> customCycleNext,
+                       std::function<uint32_t(uint32_t)> customCyclePrevious)
             : ComponentWithParamMenu(editorIn, paramIn)
             , component()
-            , attachment(paramIn, [this](float v) { updateDisplay(v); }, undoManager)
+            , attachment(paramIn, [this](float v) { updateDisplay(v); }, undoManager, dispatcher)
             , customValueCallback(valueChangedCallback)
             , customCycleNextFunc(customCycleNext)
             , customCyclePreviousFunc(customCyclePrevious)
@@ -602,19 +990,12 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
             attachment.sendInitialUpdate();
         }
 
-        void resized() override {
-            component.setBounds(getLocalBounds());
-        }
-
-        CustomComponent& getComponent() { return component; }
-        juce::ParameterAttachment& getAttachment() { return attachment; }
-
-    private:
         CustomComponent component;
-        juce::ParameterAttachment attachment;
+        OptionallyBatchedParameterAttachment attachment;
         std::function<void(float)> customValueCallback;
         std::function<uint32_t(uint32_t)> customCycleNextFunc;
         std::function<uint32_t(uint32_t)> customCyclePreviousFunc;
+        GestureCoalescer* coalescer = nullptr;
 
         void updateDisplay(float newValue) {
             component.setValue(newValue);
@@ -643,7 +1024,7 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
                 }
             }
 
-            attachment.setValueAsCompleteGesture(newValue);
+            setValueAsGesture(newValue);
         }
 
         void cycleToNext() {
@@ -666,11 +1047,18 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
                 }
             }
 
-            attachment.setValueAsCompleteGesture(newValue);
+            setValueAsGesture(newValue);
         }
 
         void setValueDirect(float value) {
-            attachment.setValueAsCompleteGesture(value);
+            setValueAsGesture(value);
+        }
+
+        void setValueAsGesture(float newValue) {
+            if (coalescer != nullptr)
+                coalescer->setValue(attachment, newValue);
+            else
+                attachment.setValueAsCompleteGesture(newValue);
         }
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AttachedCycler)
@@ -679,17 +1067,58 @@ Make sure to call sendInitialUpdate at the end of your new attachment's construc
     using Px = juce::Grid::Px;
     using Fr = juce::Grid::Fr;
 
-    struct GetTrackInfo {
-        // Combo boxes need a lot of room
-        juce::Grid::TrackInfo operator() (AttachedCombo&) const { return Px (120); }
+    // How much room a component type asks for when a CachedGridLayout takes its tracks from its items.
+    // Specialise with a static get (const ComponentType&) for your own components. The primary template is empty,
+    // so a type is only known through a specialisation or by deriving from one of the Attached* controls below.
+    template <typename ComponentType>
+    struct TrackInfoTraits {};
+
+    template <>
+    struct TrackInfoTraits<AttachedCombo> {
+        static juce::Grid::TrackInfo get (const AttachedCombo&) { return Px (120); }
+    };
+
+    template <>
+    struct TrackInfoTraits<AttachedToggle> {
+        static juce::Grid::TrackInfo get (const AttachedToggle&) { return Px (80); }
+    };
+
+    template <>
+    struct TrackInfoTraits<AttachedSlider> {
+        static juce::Grid::TrackInfo get (const AttachedSlider&) { return Fr (1); }
+    };
 
-        // Toggles are a bit smaller
-        juce::Grid::TrackInfo operator() (AttachedToggle&) const { return Px (80); }
+    template <typename ComponentType>
+    constexpr auto resolveTrackInfoTraits() {
+        if constexpr (requires (const ComponentType& c) { TrackInfoTraits<ComponentType>::get (c); })
+            return std::type_identity<TrackInfoTraits<ComponentType>> {};
+        else if constexpr (std::is_base_of_v<AttachedCombo, ComponentType>)
+            return std::type_identity<TrackInfoTraits<AttachedCombo>> {};
+        else if constexpr (std::is_base_of_v<AttachedToggle, ComponentType>)
+            return std::type_identity<TrackInfoTraits<AttachedToggle>> {};
+        else if constexpr (std::is_base_of_v<AttachedSlider, ComponentType>)
+            return std::type_identity<TrackInfoTraits<AttachedSlider>> {};
+        else
+            return std::type_identity<void> {};
+    }
 
-        // Sliders take up as much room as they can
-        juce::Grid::TrackInfo operator() (AttachedSlider&) const { return Fr (1); }
+    // The TrackInfoTraits that apply to a component: its own specialisation, else that of the Attached* control
+    // it derives from, else void. cv and reference qualifiers are ignored.
+    template <typename ComponentType>
+    using TrackInfoTraitsFor = typename decltype (resolveTrackInfoTraits<std::remove_cvref_t<ComponentType>>())::type;
+
+    // TrackInfoTraits as a function object, for use over a pack of components
+    struct GetTrackInfo {
+        template <typename ComponentType>
+        juce::Grid::TrackInfo operator() (const ComponentType& component) const {
+            using Traits = TrackInfoTraitsFor<ComponentType>;
+            static_assert (!std::is_void_v<Traits>, "no TrackInfoTraits for this component type, specialise it");
+            return Traits::get (component);
+        }
     };
 
+    // Builds a fresh 2x2 grid on every call. Editors that resize often or hold many controls should keep a
+    // CachedGridLayout instead, which reuses its grid and results.
     template <typename... Components>
     static void performLayout (const juce::Rectangle<int>& bounds, Components&... components) {
         juce::Grid grid;
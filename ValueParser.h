@@ -0,0 +1,108 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+#include <charconv>
+
+namespace moiraesoftware {
+
+    // A unit the text-to-value parsers accept after the number, e.g. { "khz", 1000.0f }.
+    // Suffixes are matched case-insensitively (ASCII), so list them in lower case.
+    struct UnitSuffix {
+        std::string_view suffix;
+        float            scale = 1.0f;
+    };
+
+    /*
+    Shared engine behind the *FromString lambdas. Everything works on a std::string_view over the juce::String's own
+    UTF-8 storage and numbers are read with std::from_chars, so parsing a value never copies or allocates.
+
+    The rules are the same for every unit:
+      - leading and trailing whitespace is ignored, as is whitespace between the number and its unit
+      - units match case-insensitively, the first matching entry of the suffix table wins
+      - the number is the longest valid prefix, like juce::String::getFloatValue(), and 0 if there is none
+    */
+    struct ValueParser {
+        // No copy as long as juce stores strings as UTF-8 (the default JUCE_STRING_UTF_TYPE)
+        static std::string_view view (const juce::String& text) noexcept {
+            return { text.toRawUTF8(), text.getNumBytesAsUTF8() };
+        }
+
+        static constexpr bool isSpace (char c) noexcept {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+        }
+
+        static constexpr char toLower (char c) noexcept { return c >= 'A' && c <= 'Z' ? static_cast<char> (c + ('a' - 'A')) : c; }
+
+        static constexpr std::string_view trim (std::string_view text) noexcept {
+            while (!text.empty() && isSpace (text.front()))
+                text.remove_prefix (1);
+            while (!text.empty() && isSpace (text.back()))
+                text.remove_suffix (1);
+            return text;
+        }
+
+        static constexpr bool equalsIgnoreCase (std::string_view text, std::string_view lowerCase) noexcept {
+            if (text.size() != lowerCase.size())
+                return false;
+            for (std::size_t i = 0; i < text.size(); ++i)
+                if (toLower (text[i]) != lowerCase[i])
+                    return false;
+            return true;
+        }
+
+        static constexpr bool startsWithIgnoreCase (std::string_view text, std::string_view lowerCase) noexcept {
+            return text.size() >= lowerCase.size() && equalsIgnoreCase (text.substr (0, lowerCase.size()), lowerCase);
+        }
+
+        static constexpr bool endsWithIgnoreCase (std::string_view text, std::string_view lowerCase) noexcept {
+            return text.size() >= lowerCase.size()
+                   && equalsIgnoreCase (text.substr (text.size() - lowerCase.size()), lowerCase);
+        }
+
+        // Longest numeric prefix after optional whitespace and sign, 0 if there is none
+        static float parseNumber (std::string_view text) noexcept {
+            text = trim (text);
+
+            // from_chars takes '-' but not '+'
+            if (!text.empty() && text.front() == '+')
+                text.remove_prefix (1);
+
+            float      value  = 0.0f;
+            const auto result = std::from_chars (text.data(), text.data() + text.size(), value);
+            return result.ec == std::errc() ? value : 0.0f;
+        }
+
+        // Strips the first matching unit and applies its scale, otherwise parses the bare number with defaultScale
+        template <typename Suffixes>
+        static float parseWithUnits (std::string_view text, const Suffixes& suffixes, float defaultScale = 1.0f) noexcept {
+            text = trim (text);
+
+            for (const UnitSuffix& unit : suffixes)
+                if (endsWithIgnoreCase (text, unit.suffix))
+                    return parseNumber (text.substr (0, text.size() - unit.suffix.size())) * unit.scale;
+
+            return parseNumber (text) * defaultScale;
+        }
+
+        template <typename Suffixes>
+        static float parseWithUnits (const juce::String& text, const Suffixes& suffixes, float defaultScale = 1.0f) noexcept {
+            return parseWithUnits (view (text), suffixes, defaultScale);
+        }
+    };
+
+    // Suffix tables for the units the parameter factories format. Longer suffixes come first where one ends
+    // with another (khz before hz, bits before bit).
+    namespace UnitSuffixes {
+        inline constexpr std::array<UnitSuffix, 1> decibels { { { "db" } } };
+        inline constexpr std::array<UnitSuffix, 1> milliseconds { { { "ms" } } };
+        inline constexpr std::array<UnitSuffix, 1> seconds { { { "s" } } };
+        inline constexpr std::array<UnitSuffix, 1> hertz { { { "hz" } } };
+        inline constexpr std::array<UnitSuffix, 3> frequency { { { "khz", 1000.0f }, { "hz", 1.0f }, { "k", 1000.0f } } };
+        inline constexpr std::array<UnitSuffix, 1> percent { { { "%" } } };
+        inline constexpr std::array<UnitSuffix, 1> multiplier { { { "x" } } };
+        inline constexpr std::array<UnitSuffix, 1> ratio { { { ":1" } } };
+        inline constexpr std::array<UnitSuffix, 2> degrees { { { "\xc2\xb0" }, { "deg" } } };
+        inline constexpr std::array<UnitSuffix, 2> bits { { { "bits" }, { "bit" } } };
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+#include <charconv>
+
+namespace moiraesoftware {
+
+    /*
+    Fixed-size UTF-8 text buffer the value-to-text formatters write into, so formatting a value costs no heap
+    allocation until (and unless) the caller asks for a juce::String.
+
+    appendFixed produces exactly what juce::String (value, decimalPlaces) does, so formatters built on it keep
+    their existing output.
+    */
+    class ValueText {
+    public:
+        static constexpr std::size_t capacity = 64;
+
+        ValueText& append (std::string_view text) noexcept {
+            // a formatter suffix never gets near the capacity, anything longer is truncated
+            jassert (text.size() <= capacity - length);
+            const auto count = std::min (text.size(), capacity - length);
+            std::memcpy (buffer.data() + length, text.data(), count);
+            length += count;
+            return *this;
+        }
+
+        ValueText& append (const char* text) noexcept { return append (std::string_view (text)); }
+
+        ValueText& append (const juce::String& text) noexcept {
+            return append (std::string_view (text.toRawUTF8(), text.getNumBytesAsUTF8()));
+        }
+
+        ValueText& appendInt (int value) noexcept {
+            const auto result = std::to_chars (buffer.data() + length, buffer.data() + capacity, value);
+            jassert (result.ec == std::errc());
+            length = static_cast<std::size_t> (result.ptr - buffer.data());
+            return *this;
+        }
+
+        // Same digits as juce::String (value, decimalPlaces)
+        ValueText& appendFixed (float value, int decimalPlaces) noexcept {
+            const auto n = static_cast<double> (value);
+
+            if (decimalPlaces > 0 && decimalPlaces < 7 && n > -1.0e20 && n < 1.0e20) {
+                // juce rounds |n| scaled by 10^decimalPlaces half up, then inserts the point and sign
+                const auto scaled = static_cast<juce::int64> (std::pow (10.0, decimalPlaces) * std::abs (n) + 0.5);
+
+                std::array<char, 24> digits {};
+                const auto* digitsEnd = std::to_chars (digits.data(), digits.data() + digits.size(), scaled).ptr;
+                const auto  numDigits = static_cast<std::size_t> (digitsEnd - digits.data());
+                const auto  places    = static_cast<std::size_t> (decimalPlaces);
+
+                if (n < 0)
+                    append ("-");
+
+                if (numDigits > places) {
+                    append ({ digits.data(), numDigits - places });
+                    append (".");
+                    return append ({ digitsEnd - places, places });
+                }
+
+                // at least one digit before the point
+                append ("0.");
+                for (auto i = numDigits; i < places; ++i)
+                    append ("0");
+                return append ({ digits.data(), numDigits });
+            }
+
+            // juce streams anything else: fixed with the requested precision, or default (%g) formatting for 0 places
+            const auto result = decimalPlaces > 0
+                                    ? std::to_chars (buffer.data() + length, buffer.data() + capacity, n, std::chars_format::fixed, decimalPlaces)
+                                    : std::to_chars (buffer.data() + length, buffer.data() + capacity, n, std::chars_format::general, 6);
+            jassert (result.ec == std::errc());
+            if (result.ec == std::errc())
+                length = static_cast<std::size_t> (result.ptr - buffer.data());
+            return *this;
+        }
+
+        [[nodiscard]] std::string_view view() const noexcept { return { buffer.data(), length }; }
+
+        [[nodiscard]] std::size_t size() const noexcept { return length; }
+
+        void clear() noexcept { length = 0; }
+
+        // The one allocation, for APIs that need a juce::String
+        [[nodiscard]] juce::String toString() const {
+            return juce::String (juce::CharPointer_UTF8 (buffer.data()), juce::CharPointer_UTF8 (buffer.data() + length));
+        }
+
+    private:
+        std::array<char, capacity> buffer {};
+        std::size_t                length = 0;
+    };
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <parameter_helpers/parameter_helpers.h>
+
+#include <chrono>
+#include <cstdio>
+
+namespace moiraesoftware::bench {
+
+    // Counted by the global operator new replacement in Main.cpp
+    std::uint64_t allocationCount() noexcept;
+    std::uint64_t allocatedBytes() noexcept; // total requested, frees are not subtracted
+    std::uint64_t liveBytes() noexcept;      // requested and not yet freed
+
+    // Keeps the optimiser from discarding a result
+    inline const volatile void* volatile sink = nullptr;
+
+    template <typename T>
+    void doNotOptimise (const T& value) noexcept {
+        sink = &value;
+    }
+
+    class Runner {
+    public:
+        Runner (std::string filterIn, int iterationsIn) : filter (std::move (filterIn)), iterations (iterationsIn) {}
+
+        [[nodiscard]] bool isEnabled (std::string_view name) const {
+            return filter.empty() || name.find (filter) != std::string_view::npos;
+        }
+
+        [[nodiscard]] int getIterations() const noexcept { return iterations; }
+
+        // Times op () over the configured number of iterations (scaled by iterationScale for expensive cases)
+        // after a short warm-up and writes {"name", "iterations", "ns_per_op", "allocs_per_op"} as one JSON line.
+        template <typename Op>
+        void measure (std::string_view name, Op&& op, double iterationScale = 1.0) {
+            if (!isEnabled (name))
+                return;
+
+            const auto count = std::max (1, static_cast<int> (iterations * iterationScale));
+
+            for (int i = 0; i < std::max (1, count / 10); ++i)
+                op();
+
+            const auto allocationsBefore = allocationCount();
+            const auto start             = std::chrono::steady_clock::now();
+
+            for (int i = 0; i < count; ++i)
+                op();
+
+            const auto elapsed     = std::chrono::steady_clock::now() - start;
+            const auto allocations = allocationCount() - allocationsBefore;
+            const auto ns          = std::chrono::duration<double, std::nano> (elapsed).count();
+
+            std::printf ("{\"name\":\"%.*s\",\"iterations\":%d,\"ns_per_op\":%.3f,\"allocs_per_op\":%.3f}\n",
+                         static_cast<int> (name.size()),
+                         name.data(),
+                         count,
+                         ns / count,
+                         static_cast<double> (allocations) / count);
+            std::fflush (stdout);
+        }
+
+        // For values that are not timings, e.g. the maximum error of an approximation
+        void report (std::string_view name, std::string_view metric, double value) {
+            if (!isEnabled (name))
+                return;
+
+            std::printf ("{\"name\":\"%.*s\",\"%.*s\":%.9g}\n",
+                         static_cast<int> (name.size()),
+                         name.data(),
+                         static_cast<int> (metric.size()),
+                         metric.data(),
+                         value);
+            std::fflush (stdout);
+        }
+
+    private:
+        std::string filter;
+        int         iterations;
+    };
+
+    // Minimal processor so the APVTS-based helpers can be exercised without a host
+    class BenchmarkProcessor : public juce::AudioProcessor {
+    public:
+        const juce::String getName() const override { return "ParameterHelpersBenchmarks"; }
+        void               prepareToPlay (double, int) override {}
+        void               releaseResources() override {}
+        void               processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override {}
+        double             getTailLengthSeconds() const override { return 0.0; }
+        bool               acceptsMidi() const override { return false; }
+        bool               producesMidi() const override { return false; }
+        juce::AudioProcessorEditor* createEditor() override { return nullptr; }
+        bool               hasEditor() const override { return false; }
+        int                getNumPrograms() override { return 1; }
+        int                getCurrentProgram() override { return 0; }
+        void               setCurrentProgram (int) override {}
+        const juce::String getProgramName (int) override { return {}; }
+        void               changeProgramName (int, const juce::String&) override {}
+        void               getStateInformation (juce::MemoryBlock&) override {}
+        void               setStateInformation (const void*, int) override {}
+    };
+
+    // numParameters plain float parameters with ids "p0", "p1", ...
+    inline std::vector<juce::ParameterID> makeParameterIDs (int numParameters) {
+        std::vector<juce::ParameterID> ids;
+        ids.reserve (static_cast<std::size_t> (numParameters));
+        for (int i = 0; i < numParameters; ++i)
+            ids.emplace_back ("p" + juce::String (i), 1);
+        return ids;
+    }
+
+    inline juce::AudioProcessorValueTreeState::ParameterLayout makeLayout (const std::vector<juce::ParameterID>& ids) {
+        juce::AudioProcessorValueTreeState::ParameterLayout layout;
+        for (const auto& id : ids)
+            layout.add (std::make_unique<juce::AudioParameterFloat> (id, id.getParamID(), juce::NormalisableRange<float> (0.0f, 1.0f), 0.5f));
+        return layout;
+    }
+
+    using BenchmarkFunction = void (*) (Runner&);
+
+    std::vector<BenchmarkFunction>& registeredBenchmarks();
+
+    // Each benchmark file registers its cases with a static instance of this
+    struct Registration {
+        explicit Registration (BenchmarkFunction function) { registeredBenchmarks().push_back (function); }
+    };
+}
@@ -0,0 +1,93 @@
+#include "Benchmark.h"
+
+namespace moiraesoftware::bench {
+    namespace {
+        const juce::ParameterID frequencyID { "benchFrequency", 1 };
+
+        // Cycles through a spread of values so branches on magnitude are all exercised
+        template <typename Format>
+        void measureFormatter (Runner& runner, std::string_view name, Format&& format, float low, float high) {
+            std::array<float, 64> values {};
+            for (std::size_t i = 0; i < values.size(); ++i)
+                values[i] = low + (high - low) * static_cast<float> (i) / static_cast<float> (values.size() - 1);
+
+            std::size_t next = 0;
+            runner.measure (name, [&] {
+                auto text = format (values[next++ & (values.size() - 1)]);
+                doNotOptimise (text);
+            });
+        }
+
+        template <typename Lambda>
+        auto asFormatter (Lambda lambda) {
+            return [lambda] (float value) { return lambda (value, 0); };
+        }
+
+        template <typename Write>
+        auto intoValueText (Write write) {
+            return [write] (float value) {
+                ValueText text;
+                write (text, value);
+                return text.size();
+            };
+        }
+
+        void run (Runner& runner) {
+            measureFormatter (runner, "stringFromPanValue", asFormatter (stringFromPanValue), -100.0f, 100.0f);
+            measureFormatter (runner, "stringFromDBValue", asFormatter (stringFromDBValue), -60.0f, 12.0f);
+            measureFormatter (runner, "stringFromValue", asFormatter (stringFromValue), -10.0f, 10.0f);
+            measureFormatter (runner, "stringFromMsValue", asFormatter (stringFromMsValue), 0.1f, 500.0f);
+            measureFormatter (runner, "stringFromRateHz", asFormatter (stringFromRateHz), 0.01f, 40.0f);
+            measureFormatter (runner, "stringFromRatioValue", asFormatter (stringFromRatioValue), 1.0f, 20.0f);
+            measureFormatter (runner, "stringFromSecondsValue", asFormatter (stringFromSecondsValue), 0.0f, 10.0f);
+            measureFormatter (runner, "stringFromDegreesValue", asFormatter (stringFromDegreesValue), -180.0f, 180.0f);
+            measureFormatter (runner, "stringFromMultiplierValue", asFormatter (stringFromMultiplierValue), 0.0f, 4.0f);
+            measureFormatter (runner, "stringFromBitsValue", asFormatter (stringFromBitsValue), 1.0f, 24.0f);
+
+            measureFormatter (runner, "makeStringFromValueWithOffAt",
+                              asFormatter (makeStringFromValueWithOffAt (0.0f, " dB", "OFF")), 0.0f, 12.0f);
+            measureFormatter (runner, "makeStringFromValueWithFrequency<Hz>",
+                              asFormatter (makeStringFromValueWithFrequency<FrequencyUnit::Hz>()), 20.0f, 20000.0f);
+            measureFormatter (runner, "makeStringFromValueWithFrequency<kHz>",
+                              asFormatter (makeStringFromValueWithFrequency<FrequencyUnit::kHz>()), 20.0f, 20000.0f);
+            measureFormatter (runner, "makeStringFromValueWithFrequencyWithOffAt<Hz>",
+                              asFormatter (makeStringFromValueWithFrequencyWithOffAt<FrequencyUnit::Hz> (20.0f, 0)), 20.0f, 20000.0f);
+            measureFormatter (runner, "makeStringFromValueWithFrequencyWithOffAt<kHz>",
+                              asFormatter (makeStringFromValueWithFrequencyWithOffAt<FrequencyUnit::kHz> (20000.0f, 0)), 20.0f, 20000.0f);
+
+            // The allocation-free layer underneath the lambdas
+            measureFormatter (runner, "writeDBValue", intoValueText ([] (ValueText& t, float v) { writeDBValue (t, v); }), -60.0f, 12.0f);
+            measureFormatter (runner, "writeMsValue", intoValueText ([] (ValueText& t, float v) { writeMsValue (t, v); }), 0.1f, 500.0f);
+            measureFormatter (runner, "writeFrequencyValue<kHz>",
+                              intoValueText ([] (ValueText& t, float v) { writeFrequencyValue<FrequencyUnit::kHz> (t, v); }), 20.0f, 20000.0f);
+
+            // Cost of the factories themselves, paid once per parameter when a layout is built
+            runner.measure ("factory:makeStringFromValueWithFrequency<kHz>", [] {
+                auto formatter = makeStringFromValueWithFrequency<FrequencyUnit::kHz>();
+                doNotOptimise (formatter);
+            });
+            runner.measure ("factory:makeFromStringWithFrequencyWithOffAt<Hz>", [] {
+                auto parser = makeFromStringWithFrequencyWithOffAt<FrequencyUnit::Hz> (20.0f);
+                doNotOptimise (parser);
+            });
+            runner.measure ("factory:makeStringFromValueWithOffAt", [] {
+                auto formatter = makeStringFromValueWithOffAt (0.0f, " dB", "OFF");
+                doNotOptimise (formatter);
+            });
+
+            // Full parameter construction through the frequency factories, including the attributes
+            runner.measure ("factory:makeFrequencyParam", [] {
+                juce::AudioProcessorValueTreeState::ParameterLayout layout;
+                auto& param = makeFrequencyParam<frequencyID> ("Frequency", juce::NormalisableRange<float> (20.0f, 20000.0f), 1000.0f) (layout);
+                doNotOptimise (param);
+            }, 0.05);
+            runner.measure ("factory:makeFrequencyParamWithOff", [] {
+                juce::AudioProcessorValueTreeState::ParameterLayout layout;
+                auto& param = makeFrequencyParamWithOff<frequencyID> ("Frequency", juce::NormalisableRange<float> (19.0f, 220.0f), 19.0f, 19.0f) (layout);
+                doNotOptimise (param);
+            }, 0.05);
+        }
+
+        const Registration registration { run };
+    }
+}
@@ -0,0 +1,128 @@
+#include "Benchmark.h"
+
+namespace moiraesoftware::bench {
+    namespace {
+        constexpr int numParameters = 2048;
+
+        constexpr std::array<UnitKind, 4> units { UnitKind::decibels, UnitKind::frequencyKHz, UnitKind::milliseconds, UnitKind::percent };
+
+        // What the makeXParam factories do for each parameter: a fresh attributes object with its own formatters
+        juce::AudioParameterFloatAttributes makeAttributes (UnitKind unit) {
+            switch (unit) {
+                case UnitKind::decibels:
+                    return juce::AudioParameterFloatAttributes().withStringFromValueFunction (stringFromDBValue).withValueFromStringFunction (dBFromString);
+                case UnitKind::frequencyKHz:
+                    return juce::AudioParameterFloatAttributes()
+                        .withStringFromValueFunction (makeStringFromValueWithFrequency<FrequencyUnit::kHz>())
+                        .withValueFromStringFunction (makeFromStringWithFrequency<FrequencyUnit::kHz>());
+                case UnitKind::milliseconds:
+                    return juce::AudioParameterFloatAttributes().withStringFromValueFunction (stringFromMsValue).withValueFromStringFunction (msValueFromString);
+                default:
+                    return juce::AudioParameterFloatAttributes()
+                        .withStringFromValueFunction (stringFromPercentValueWithDigits<1>)
+                        .withValueFromStringFunction (percentValueFromString);
+            }
+        }
+
+        // A plug-in's layout as a host would build it for each instance: fader ranges with lookup tables,
+        // formatters with captured text and choice lists
+        constexpr int numInstances          = 128;
+        constexpr int numPerKind            = 16;
+        constexpr int numInstanceParameters = numPerKind * 3;
+
+        juce::StringArray makeModes() {
+            juce::StringArray modes;
+            for (int i = 0; i < 16; ++i)
+                modes.add ("Mode " + juce::String (i + 1));
+            return modes;
+        }
+
+        juce::AudioParameterFloatAttributes makeCutoffAttributes() {
+            return juce::AudioParameterFloatAttributes()
+                .withStringFromValueFunction (makeStringFromValueWithOffAt (20.0f, " Hz", "OFF"))
+                .withValueFromStringFunction (makeFromStringWithOffAt (20.0f, " Hz", "OFF"));
+        }
+
+        template <typename Faders, typename Modes, typename Cutoffs>
+        juce::AudioProcessorValueTreeState::ParameterLayout makeInstanceLayout (const std::vector<juce::ParameterID>& ids,
+                                                                                Faders&&                              fader,
+                                                                                Modes&&                               modes,
+                                                                                Cutoffs&&                             cutoff) {
+            juce::AudioProcessorValueTreeState::ParameterLayout layout;
+            std::size_t                                         next = 0;
+            for (int i = 0; i < numPerKind; ++i) {
+                addToLayout<juce::AudioParameterFloat> (layout, ids[next++], "Fader", fader(), 0.0f);
+                addToLayout<juce::AudioParameterChoice> (layout, ids[next++], "Mode", modes(), 0);
+                addToLayout<juce::AudioParameterFloat> (layout, ids[next++], "Cutoff", juce::NormalisableRange<float> (20.0f, 20000.0f), 20.0f, cutoff());
+            }
+            return layout;
+        }
+
+        void runInstances (Runner& runner) {
+            const auto ids = makeParameterIDs (numInstanceParameters);
+
+            const auto perInstance = [&] {
+                return makeInstanceLayout (ids, [] { return logarithmicThenLinearRangeLUT (-60.0f, 12.0f, 0.0f); }, makeModes, makeCutoffAttributes);
+            };
+
+            const auto shared = [&] {
+                SharedParameterResourcesPointer resources;
+                return makeInstanceLayout (
+                    ids,
+                    [&] { return resources->logarithmicThenLinearRangeLUT (-60.0f, 12.0f, 0.0f); },
+                    [&] { return resources->getChoices ("modes", makeModes); },
+                    [&] { return resources->getFloatAttributes ("cutoff", makeCutoffAttributes); });
+            };
+
+            // The instances stay alive together, as in a session, while the next one is built
+            const auto buildAll = [] (auto&& build) {
+                std::vector<juce::AudioProcessorValueTreeState::ParameterLayout> layouts;
+                layouts.reserve (numInstances);
+                for (int i = 0; i < numInstances; ++i)
+                    layouts.push_back (build());
+                return layouts;
+            };
+
+            // One store alive for the whole session, as with any instance open
+            SharedParameterResourcesPointer session;
+
+            // Memory the instances hold once built; temporaries freed while building are not counted
+            const auto reportBytes = [&] (std::string_view name, auto&& build) {
+                const auto before  = liveBytes();
+                [[maybe_unused]] const auto layouts = buildAll (build);
+                runner.report (name, "live_bytes_per_instance", static_cast<double> (liveBytes() - before) / numInstances);
+            };
+
+            reportBytes ("instances:128:per-instance-resources", perInstance);
+            reportBytes ("instances:128:shared-resources", shared);
+
+            runner.measure ("instances:128:per-instance-resources", [&] { doNotOptimise (buildAll (perInstance)); }, 0.0005);
+            runner.measure ("instances:128:shared-resources", [&] { doNotOptimise (buildAll (shared)); }, 0.0005);
+        }
+
+        void run (Runner& runner) {
+            runInstances (runner);
+
+            const auto ids = makeParameterIDs (numParameters);
+
+            std::vector<ParameterSpec> table;
+            table.reserve (ids.size());
+            for (std::size_t i = 0; i < ids.size(); ++i)
+                table.push_back ({ ids[i], "Parameter", { 0.0f, 1.0f }, 0.5f, units[i % units.size()] });
+
+            runner.measure ("layout:per-parameter-attributes", [&] {
+                juce::AudioProcessorValueTreeState::ParameterLayout layout;
+                for (const auto& spec : table)
+                    addToLayout<juce::AudioParameterFloat> (layout, spec.id, "Parameter", spec.range.toRange(), spec.defaultValue, makeAttributes (spec.unit));
+                doNotOptimise (layout);
+            }, 0.0005);
+
+            runner.measure ("layout:table", [&] {
+                auto layout = makeParameterLayout (table);
+                doNotOptimise (layout);
+            }, 0.0005);
+        }
+
+        const Registration registration { run };
+    }
+}
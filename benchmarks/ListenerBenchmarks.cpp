@@ -0,0 +1,146 @@
+#include "Benchmark.h"
+
+namespace moiraesoftware::bench {
+    namespace {
+        constexpr std::size_t numParameters = 512;
+
+        // The string-keyed path: one APVTS listener for every id, which has to find out which
+        // parameter changed from the parameterID it is handed
+        struct StringKeyedListener final : juce::AudioProcessorValueTreeState::Listener {
+            explicit StringKeyedListener (const std::vector<juce::ParameterID>& ids) {
+                for (std::size_t i = 0; i < ids.size(); ++i)
+                    indices.emplace (ids[i].getParamID(), i);
+            }
+
+            void parameterChanged (const juce::String& parameterID, float) override {
+                if (const auto it = indices.find (parameterID); it != indices.end())
+                    mask.markDirty (it->second);
+            }
+
+            std::map<juce::String, std::size_t> indices;
+            ParameterDirtyMask<numParameters>   mask;
+        };
+
+        void run (Runner& runner) {
+            const auto ids = makeParameterIDs (static_cast<int> (numParameters));
+
+            std::array<const juce::ParameterID*, numParameters> idPointers {};
+            for (std::size_t i = 0; i < numParameters; ++i)
+                idPointers[i] = &ids[i];
+
+            // Callback cost alone, as if called by the APVTS
+            {
+                StringKeyedListener listener (ids);
+                std::size_t         next = 0;
+                runner.measure ("listener:string-keyed:callback", [&] {
+                    const auto index = next++ % numParameters;
+                    listener.parameterChanged (ids[index].getParamID(), 0.5f);
+                });
+
+                ParameterDirtyMask<numParameters>                                  mask;
+                std::array<IndexedParameterListener<numParameters>, numParameters> listeners;
+                for (std::size_t i = 0; i < numParameters; ++i) {
+                    listeners[i].index     = i;
+                    listeners[i].dirtyMask = &mask;
+                }
+                runner.measure ("listener:indexed:callback", [&] {
+                    const auto index = next++ % numParameters;
+                    listeners[index].parameterChanged (ids[index].getParamID(), 0.5f);
+                });
+            }
+
+            // End to end: setValueNotifyingHost through the APVTS to the listener
+            BenchmarkProcessor                       processor;
+            juce::AudioProcessorValueTreeState       state (processor, nullptr, "state", makeLayout (ids));
+            std::vector<juce::RangedAudioParameter*> parameters;
+            for (const auto& id : ids)
+                parameters.push_back (state.getParameter (id.getParamID()));
+
+            std::size_t next    = 0;
+            float       value   = 0.0f;
+            const auto  setNext = [&] {
+                value = value > 0.5f ? 0.25f : 0.75f;
+                parameters[next++ % numParameters]->setValueNotifyingHost (value);
+            };
+
+            {
+                StringKeyedListener listener (ids);
+                for (const auto& id : ids)
+                    state.addParameterListener (id.getParamID(), &listener);
+
+                runner.measure ("listener:string-keyed:apvts", setNext);
+
+                for (const auto& id : ids)
+                    state.removeParameterListener (id.getParamID(), &listener);
+            }
+            {
+                ParameterListenerManager<numParameters> manager (state, idPointers);
+                runner.measure ("listener:indexed:apvts", setNext);
+                runner.measure ("listener:indexed:consumeDirtyParameters", [&] {
+                    const auto dirty = manager.consumeDirtyParameters();
+                    doNotOptimise (dirty);
+                });
+
+                // The same with activity counters and latency histograms switched on
+                ParameterInstrumentation<numParameters> activity;
+                manager.enableInstrumentation (activity);
+                runner.measure ("listener:indexed:apvts:instrumented", setNext);
+                runner.measure ("listener:indexed:set+consume:instrumented", [&] {
+                    setNext();
+                    const auto dirty = manager.consumeDirtyParameters();
+                    doNotOptimise (dirty);
+                });
+                manager.disableInstrumentation();
+
+                const auto snapshot = activity.getSnapshot();
+                runner.report ("listener:instrumented:latency", "p50_us", snapshot.latencyPercentile (0.5) * 1.0e6);
+                runner.report ("listener:instrumented:latency", "p99_us", snapshot.latencyPercentile (0.99) * 1.0e6);
+            }
+
+            // Three models watching every parameter: a manager each, then one router with three subscribers
+            {
+                ParameterListenerManager<numParameters> channel (state, idPointers);
+                ParameterListenerManager<numParameters> global (state, idPointers);
+                ParameterListenerManager<numParameters> ui (state, idPointers);
+                runner.measure ("listener:3-managers:apvts", setNext);
+            }
+            {
+                ParameterRouter<numParameters>    router (state, idPointers);
+                ParameterDirtyMask<numParameters> channel, global, ui;
+                router.subscribe (channel);
+                router.subscribe (global);
+                router.subscribe (ui);
+                runner.measure ("listener:router-3-subscribers:apvts", setNext);
+            }
+
+            // One block's worth of change detection at several automation densities: the callback mode pays per
+            // change, the poller pays per watched parameter however many changed
+            for (const auto changesPerBlock : { 0, 1, 16, 128, static_cast<int> (numParameters) }) {
+                const auto block = [&] {
+                    for (int c = 0; c < changesPerBlock; ++c)
+                        setNext();
+                };
+                const auto suffix = ":changes-per-block-" + std::to_string (changesPerBlock);
+
+                {
+                    ParameterListenerManager<numParameters> manager (state, idPointers);
+                    runner.measure ("listener:callback" + suffix, [&] {
+                        block();
+                        const auto dirty = manager.consumeDirtyParameters();
+                        doNotOptimise (dirty);
+                    });
+                }
+                {
+                    ParameterChangePoller<numParameters> poller (state, idPointers);
+                    runner.measure ("listener:poll" + suffix, [&] {
+                        block();
+                        const auto dirty = poller.poll();
+                        doNotOptimise (dirty);
+                    });
+                }
+            }
+        }
+
+        const Registration registration { run };
+    }
+}
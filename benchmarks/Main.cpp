@@ -0,0 +1,101 @@
+#include "Benchmark.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace {
+    std::atomic<std::uint64_t> allocations { 0 };
+    std::atomic<std::uint64_t> bytes { 0 };
+    std::atomic<std::uint64_t> freedBytes { 0 };
+
+    // Every block carries its requested size in front, so frees can be subtracted whichever operator delete
+    // the compiler picks. The header keeps the result aligned for any fundamental type.
+    constexpr std::size_t headerSize = alignof (std::max_align_t);
+
+    void* allocate (std::size_t size) noexcept {
+        auto* block = static_cast<unsigned char*> (std::malloc (headerSize + size));
+        if (block == nullptr)
+            return nullptr;
+
+        allocations.fetch_add (1, std::memory_order_relaxed);
+        bytes.fetch_add (size, std::memory_order_relaxed);
+        std::memcpy (block, &size, sizeof (size));
+        return block + headerSize;
+    }
+
+    void release (void* p) noexcept {
+        if (p == nullptr)
+            return;
+
+        auto*       block = static_cast<unsigned char*> (p) - headerSize;
+        std::size_t size  = 0;
+        std::memcpy (&size, block, sizeof (size));
+        freedBytes.fetch_add (size, std::memory_order_relaxed);
+        std::free (block);
+    }
+}
+
+void* operator new (std::size_t size) {
+    if (auto* p = allocate (size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[] (std::size_t size) {
+    return operator new (size);
+}
+
+void* operator new (std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate (size);
+}
+
+void* operator new[] (std::size_t size, const std::nothrow_t& tag) noexcept {
+    return operator new (size, tag);
+}
+
+void operator delete (void* p) noexcept { release (p); }
+void operator delete[] (void* p) noexcept { release (p); }
+void operator delete (void* p, std::size_t) noexcept { release (p); }
+void operator delete[] (void* p, std::size_t) noexcept { release (p); }
+void operator delete (void* p, const std::nothrow_t&) noexcept { release (p); }
+void operator delete[] (void* p, const std::nothrow_t&) noexcept { release (p); }
+
+namespace moiraesoftware::bench {
+    std::uint64_t allocationCount() noexcept { return allocations.load (std::memory_order_relaxed); }
+    std::uint64_t allocatedBytes() noexcept { return bytes.load (std::memory_order_relaxed); }
+    std::uint64_t liveBytes() noexcept { return bytes.load (std::memory_order_relaxed) - freedBytes.load (std::memory_order_relaxed); }
+
+    std::vector<BenchmarkFunction>& registeredBenchmarks() {
+        static std::vector<BenchmarkFunction> benchmarks;
+        return benchmarks;
+    }
+}
+
+int main (int argc, char* argv[]) {
+    // Components and images in the UI benchmarks need the message manager, but nothing is shown
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    std::string filter;
+    int         iterations = 200000;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg (argv[i]);
+
+        if (arg == "--filter" && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (arg == "--iterations" && i + 1 < argc) {
+            iterations = std::max (1, std::atoi (argv[++i]));
+        } else {
+            std::fprintf (stderr, "usage: %s [--filter <substring>] [--iterations <n>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    moiraesoftware::bench::Runner runner (filter, iterations);
+
+    for (auto* benchmark : moiraesoftware::bench::registeredBenchmarks())
+        benchmark (runner);
+
+    return 0;
+}
@@ -0,0 +1,42 @@
+#include "Benchmark.h"
+
+namespace moiraesoftware::bench {
+    namespace {
+        // Inputs are built once, so the timing covers parsing rather than juce::String construction
+        template <typename Parse>
+        void measureParser (Runner& runner, std::string_view name, Parse&& parse, std::initializer_list<const char*> inputs) {
+            std::vector<juce::String> texts;
+            for (const auto* input : inputs)
+                texts.emplace_back (input);
+
+            std::size_t next = 0;
+            runner.measure (name, [&] {
+                const auto value = parse (texts[next++ % texts.size()]);
+                doNotOptimise (value);
+            });
+        }
+
+        void run (Runner& runner) {
+            measureParser (runner, "panFromString", panFromString, { "C", "L 30", "r50", "-20%", "100", "40R" });
+            measureParser (runner, "dBFromString", dBFromString, { "-6.0db", "0", "-12.5", "3db" });
+            measureParser (runner, "valueFromString", valueFromString, { "0.5", "-3.25", "10" });
+            measureParser (runner, "msValueFromString", msValueFromString, { "12.5 ms", "250ms", "3" });
+            measureParser (runner, "rateHzFromString", rateHzFromString, { "0.25 Hz", "4hz", "12.5" });
+            measureParser (runner, "ratioValueFromString", ratioValueFromString, { "4.0:1", "2:1", "8" });
+            measureParser (runner, "secondsValueFromString", secondsValueFromString, { "1.25 s", "3s", "0.5" });
+            measureParser (runner, "degreesValueFromString", degreesValueFromString, { "45\xc2\xb0", "-90deg", "180" });
+            measureParser (runner, "multiplierValueFromString", multiplierValueFromString, { "2.00x", "0.5X", "1" });
+            measureParser (runner, "bitsValueFromString", bitsValueFromString, { "16 bits", "8bit", "24" });
+
+            measureParser (runner, "makeFromStringWithOffAt", makeFromStringWithOffAt (0.0f, "dB", "OFF"), { "OFF", "-6dB", "3" });
+            measureParser (runner, "makeFromStringWithFrequency<Hz>", makeFromStringWithFrequency<FrequencyUnit::Hz>(),
+                           { "440 Hz", "2.5kHz", "8k", "1000" });
+            measureParser (runner, "makeFromStringWithFrequency<kHz>", makeFromStringWithFrequency<FrequencyUnit::kHz>(),
+                           { "440 Hz", "2.5kHz", "8k", "8" });
+            measureParser (runner, "makeFromStringWithFrequencyWithOffAt<Hz>", makeFromStringWithFrequencyWithOffAt<FrequencyUnit::Hz> (19.0f),
+                           { "off", "120 Hz", "0.2k" });
+        }
+
+        const Registration registration { run };
+    }
+}
@@ -0,0 +1,82 @@
+#include "Benchmark.h"
+
+namespace moiraesoftware::bench {
+    namespace {
+        void measureRange (Runner& runner, std::string_view name, const juce::NormalisableRange<float>& range) {
+            std::array<float, 256> normalised {};
+            std::array<float, 256> plain {};
+            for (std::size_t i = 0; i < normalised.size(); ++i) {
+                normalised[i] = static_cast<float> (i) / static_cast<float> (normalised.size() - 1);
+                plain[i]      = range.start + (range.end - range.start) * normalised[i];
+            }
+
+            std::size_t next = 0;
+            runner.measure (std::string (name) + ":convertFrom0to1", [&] {
+                const auto value = range.convertFrom0to1 (normalised[next++ & 255]);
+                doNotOptimise (value);
+            });
+            runner.measure (std::string (name) + ":convertTo0to1", [&] {
+                const auto value = range.convertTo0to1 (plain[next++ & 255]);
+                doNotOptimise (value);
+            });
+            runner.measure (std::string (name) + ":snapToLegalValue", [&] {
+                const auto value = range.snapToLegalValue (plain[next++ & 255]);
+                doNotOptimise (value);
+            });
+        }
+
+        // Largest difference between the std::pow and the table ranges, in plain units and in normalised units
+        void reportAccuracy (Runner& runner,
+                             const std::string& name,
+                             const juce::NormalisableRange<float>& exact,
+                             const juce::NormalisableRange<float>& approximate) {
+            double maxPlainError      = 0.0;
+            double maxNormalisedError = 0.0;
+
+            constexpr int steps = 1000000;
+            for (int i = 0; i <= steps; ++i) {
+                const auto normalised = static_cast<float> (i) / steps;
+                const auto plain      = exact.start + (exact.end - exact.start) * normalised;
+
+                maxPlainError      = std::max (maxPlainError, static_cast<double> (std::abs (exact.convertFrom0to1 (normalised) - approximate.convertFrom0to1 (normalised))));
+                maxNormalisedError = std::max (maxNormalisedError, static_cast<double> (std::abs (exact.convertTo0to1 (plain) - approximate.convertTo0to1 (plain))));
+            }
+
+            runner.report (name, "max_plain_error", maxPlainError);
+            runner.report (name, "max_normalised_error", maxNormalisedError);
+        }
+
+        void run (Runner& runner) {
+            const auto exact       = logarithmicThenLinearRange (-60.0f, 12.0f, 0.0f);
+            const auto approximate = logarithmicThenLinearRangeLUT (-60.0f, 12.0f, 0.0f);
+
+            measureRange (runner, "logarithmicThenLinearRange", exact);
+            measureRange (runner, "logarithmicThenLinearRangeLUT", approximate);
+            measureRange (runner, "NormalisableRange:skewed", juce::NormalisableRange<float> (20.0f, 20000.0f, 0.0f, 0.25f));
+
+            if (runner.isEnabled ("logarithmicThenLinearRangeLUT:accuracy"))
+                reportAccuracy (runner, "logarithmicThenLinearRangeLUT:accuracy", exact, approximate);
+
+            // The table error grows with the exponent, so check either side of the default as well
+            for (const auto exponent : { 1.5f, 4.0f }) {
+                const auto name = "logarithmicThenLinearRangeLUT:accuracy:exponent-" + juce::String (exponent).toStdString();
+                if (runner.isEnabled (name))
+                    reportAccuracy (runner,
+                                    name,
+                                    logarithmicThenLinearRange (-60.0f, 12.0f, 0.0f, defaultLogBreakpointOnSlider, exponent),
+                                    logarithmicThenLinearRangeLUT (-60.0f, 12.0f, 0.0f, defaultLogBreakpointOnSlider, exponent));
+            }
+
+            runner.measure ("factory:logarithmicThenLinearRange", [] {
+                auto range = logarithmicThenLinearRange (-60.0f, 12.0f, 0.0f);
+                doNotOptimise (range);
+            }, 0.1);
+            runner.measure ("factory:logarithmicThenLinearRangeLUT", [] {
+                auto range = logarithmicThenLinearRangeLUT (-60.0f, 12.0f, 0.0f);
+                doNotOptimise (range);
+            }, 0.01);
+        }
+
+        const Registration registration { run };
+    }
+}
@@ -0,0 +1,95 @@
+#include "Benchmark.h"
+
+namespace moiraesoftware::bench {
+    namespace {
+        constexpr std::size_t numParameters = 8;
+        constexpr int         numChannels   = 2;
+        constexpr int         blockSize     = 512;
+        constexpr double      sampleRate    = 48000.0;
+
+        // A one-pole low-pass per channel whose coefficient is recomputed whenever its cutoff changes, standing
+        // in for DSP that pays a setup cost per sub-block
+        struct OnePole {
+            void setCutoff (float hz) noexcept { coefficient = std::exp (static_cast<float> (-juce::MathConstants<double>::twoPi * hz / sampleRate)); }
+
+            void process (juce::dsp::AudioBlock<float>& block) noexcept {
+                for (std::size_t ch = 0; ch < block.getNumChannels(); ++ch) {
+                    auto* samples = block.getChannelPointer (ch);
+                    auto  z       = state[ch];
+                    for (std::size_t i = 0; i < block.getNumSamples(); ++i)
+                        samples[i] = z = samples[i] + coefficient * (z - samples[i]);
+                    state[ch] = z;
+                }
+            }
+
+            float                          coefficient = 0.0f;
+            std::array<float, numChannels> state {};
+        };
+
+        // Timestamps are in samples, so an event pushed at previousStart + n is drained at offset n
+        void pushEvents (ParameterEventQueue<numParameters>& queue, juce::int64 previousStart, int eventsPerBlock) {
+            for (int e = 0; e < eventsPerBlock; ++e) {
+                const auto offset = (e * blockSize) / eventsPerBlock;
+                queue.push (0, 200.0f + static_cast<float> (offset), previousStart + offset);
+            }
+        }
+
+        void run (Runner& runner) {
+            juce::AudioBuffer<float> buffer (numChannels, blockSize);
+            for (int ch = 0; ch < numChannels; ++ch)
+                for (int i = 0; i < blockSize; ++i)
+                    buffer.setSample (ch, i, static_cast<float> ((i * 7919) % 101) / 50.0f - 1.0f);
+
+            juce::dsp::AudioBlock<float> block (buffer);
+
+            // Overhead of splitting compared with applying every change at the top of the block, as a plug-in
+            // without sample-accurate automation would
+            for (const auto eventsPerBlock : { 0, 1, 4, 16, 64 }) {
+                const auto suffix = ":events-per-block-" + std::to_string (eventsPerBlock);
+
+                {
+                    ParameterEventQueue<numParameters> queue;
+                    std::array<float, numParameters>   values {};
+                    OnePole                            filter;
+                    juce::int64                        blockStart = blockSize;
+
+                    values[0] = 1000.0f;
+
+                    runner.measure ("splitter:unsplit" + suffix, [&] {
+                        pushEvents (queue, blockStart - blockSize, eventsPerBlock);
+                        queue.drain (blockSize, blockStart, [&] (const ParameterEvent& event) { values[event.index] = event.value; });
+                        filter.setCutoff (values[0]);
+                        filter.process (block);
+                        blockStart += blockSize;
+                    }, 0.05);
+                }
+
+                for (const auto minimum : { 1, 32 }) {
+                    ParameterEventQueue<numParameters> queue;
+                    BlockSplitter<numParameters>       splitter;
+                    OnePole                            filter;
+                    juce::int64                        blockStart = blockSize;
+                    int                                subBlocks  = 0;
+
+                    splitter.setMinimumSubBlockSize (minimum);
+                    splitter.setValue (0, 1000.0f);
+                    filter.setCutoff (1000.0f);
+
+                    const auto name = "splitter:split:min-" + std::to_string (minimum) + suffix;
+                    runner.measure (name, [&] {
+                        pushEvents (queue, blockStart - blockSize, eventsPerBlock);
+                        subBlocks = splitter.process (queue, block, blockStart, [&] (juce::dsp::AudioBlock<float>& subBlock, const auto& parameters) {
+                            if (parameters.changed.test (0))
+                                filter.setCutoff (parameters[0]);
+                            filter.process (subBlock);
+                        });
+                        blockStart += blockSize;
+                    }, 0.05);
+                    runner.report (name, "sub_blocks_per_block", subBlocks);
+                }
+            }
+        }
+
+        const Registration registration { run };
+    }
+}
@@ -0,0 +1,90 @@
+#include "Benchmark.h"
+
+namespace moiraesoftware::bench {
+    namespace {
+        constexpr int numParameters = 512;
+
+        void run (Runner& runner) {
+            const auto                         ids = makeParameterIDs (numParameters);
+            BenchmarkProcessor                 processor;
+            juce::AudioProcessorValueTreeState state (processor, nullptr, "state", makeLayout (ids));
+            StateSnapshot                      snapshot (state);
+
+            juce::Random random (42);
+            auto randomise = [&] {
+                for (auto* p : processor.getParameters())
+                    p->setValueNotifyingHost (random.nextFloat());
+            };
+
+            // The usual getStateInformation implementation
+            auto saveXml = [&] (juce::MemoryBlock& data) {
+                const auto xml = state.copyState().createXml();
+                juce::AudioProcessor::copyXmlToBinary (*xml, data);
+            };
+
+            randomise();
+
+            juce::MemoryBlock xmlData, binaryData;
+            saveXml (xmlData);
+            snapshot.save (binaryData);
+
+            runner.report ("state:xml", "bytes", static_cast<double> (xmlData.getSize()));
+            runner.report ("state:snapshot", "bytes", static_cast<double> (binaryData.getSize()));
+
+            // Round trip: restoring must reproduce the normalised values exactly, by index and through the
+            // id-matching path used for snapshots from other versions
+            {
+                std::vector<float> saved;
+                for (auto* p : processor.getParameters())
+                    saved.push_back (p->getValue());
+
+                randomise();
+                snapshot.restore (binaryData.getData(), binaryData.getSize());
+
+                double maxError = 0.0;
+                for (int i = 0; i < numParameters; ++i)
+                    maxError = std::max (maxError, static_cast<double> (std::abs (processor.getParameters()[i]->getValue() - saved[static_cast<std::size_t> (i)])));
+                runner.report ("state:snapshot:roundtrip", "max_error", maxError);
+
+                randomise();
+                snapshot.restore (xmlData.getData(), xmlData.getSize());
+                maxError = 0.0;
+                for (int i = 0; i < numParameters; ++i)
+                    maxError = std::max (maxError, static_cast<double> (std::abs (processor.getParameters()[i]->getValue() - saved[static_cast<std::size_t> (i)])));
+                runner.report ("state:snapshot:xml-fallback", "max_error", maxError);
+            }
+
+            runner.measure ("state:save:xml", [&] {
+                juce::MemoryBlock data;
+                saveXml (data);
+                doNotOptimise (data);
+            }, 0.005);
+
+            runner.measure ("state:save:snapshot", [&] {
+                juce::MemoryBlock data;
+                snapshot.save (data);
+                doNotOptimise (data);
+            }, 0.05);
+
+            // Alternating between two states so every restore changes every parameter
+            juce::MemoryBlock otherXml, otherBinary;
+            randomise();
+            saveXml (otherXml);
+            snapshot.save (otherBinary);
+
+            bool flip = false;
+            runner.measure ("state:restore:xml", [&] {
+                const auto& data = (flip = !flip) ? xmlData : otherXml;
+                if (const auto xml = juce::AudioProcessor::getXmlFromBinary (data.getData(), static_cast<int> (data.getSize())))
+                    state.replaceState (juce::ValueTree::fromXml (*xml));
+            }, 0.005);
+
+            runner.measure ("state:restore:snapshot", [&] {
+                const auto& data = (flip = !flip) ? binaryData : otherBinary;
+                snapshot.restore (data.getData(), data.getSize());
+            }, 0.05);
+        }
+
+        const Registration registration { run };
+    }
+}
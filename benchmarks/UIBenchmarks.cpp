@@ -0,0 +1,194 @@
+#include "Benchmark.h"
+
+namespace moiraesoftware::bench {
+    namespace {
+        constexpr int numSliders = 64;
+
+        // A knob bank being dragged: every slider moves, and UpdateSuffix runs after each move, starting at the
+        // bottom of the range so the "OFF" transition is crossed on every sweep
+        template <typename MakeSlider>
+        void measureSuffixUpdates (Runner& runner, std::string_view name, MakeSlider&& makeSlider,
+                                   const std::vector<juce::RangedAudioParameter*>& parameters) {
+            if (!runner.isEnabled (name))
+                return;
+
+            std::vector<std::unique_ptr<AttachedSlider>> sliders;
+            for (auto* parameter : parameters)
+                sliders.push_back (makeSlider (*parameter));
+
+            constexpr int stepsPerSweep = 32;
+            int           step          = 0;
+            runner.measure (name, [&] {
+                const auto value = static_cast<double> (step++ % stepsPerSweep) / (stepsPerSweep - 1);
+                for (auto& slider : sliders) {
+                    slider->getSlider().setValue (value, juce::dontSendNotification);
+                    slider->UpdateSuffix();
+                }
+            }, 1.0 / numSliders);
+        }
+
+        // A 128-frame knob strip with a gradient per tile, standing in for a rendered filmstrip
+        FilmstripSpec makeFilmstrip() {
+            constexpr int tileSize = 64, columns = 16, frames = 128;
+            juce::Image   mosaic (juce::Image::ARGB, tileSize * columns, tileSize * (frames / columns), true);
+            juce::Graphics g (mosaic);
+            for (int n = 0; n < frames; ++n) {
+                g.setColour (juce::Colour::fromHSV (static_cast<float> (n) / frames, 0.8f, 0.9f, 1.0f));
+                g.fillEllipse (extractTileByNumber (mosaic, tileSize, tileSize, n).reduced (4).toFloat());
+            }
+            return { mosaic, tileSize, tileSize, frames };
+        }
+
+        // One knob repaint at 48x48: slicing and scaling from the mosaic each time, as painting straight from
+        // extractTileByNumber does, against a blit from the tile cache
+        void measureFilmstripPaint (Runner& runner) {
+            const auto spec = makeFilmstrip();
+            juce::Image target (juce::Image::ARGB, 48, 48, true);
+            juce::Graphics g (target);
+            int frame = 0;
+
+            runner.measure ("filmstrip:paint:extractTileByNumber", [&] {
+                const auto tile = extractTileByNumber (spec.mosaic, spec.tileWidth, spec.tileHeight, frame++ % spec.numFrames);
+                g.drawImage (spec.mosaic, 0, 0, 48, 48, tile.getX(), tile.getY(), tile.getWidth(), tile.getHeight());
+            }, 0.05);
+
+            FilmstripSlider slider (spec);
+            slider.setRange (0.0, 1.0);
+            slider.setBounds (0, 0, 48, 48);
+            runner.measure ("filmstrip:paint:tileCache", [&] {
+                slider.setValue (static_cast<double> (frame++ % spec.numFrames) / (spec.numFrames - 1), juce::dontSendNotification);
+                slider.paint (g);
+            }, 0.05);
+        }
+
+        // Opening an editor with 320 sliders over 10 pages, one of them visible
+        void measureEditorOpen (Runner& runner) {
+            constexpr int numPages = 10, perPage = 32;
+
+            const auto                               ids = makeParameterIDs (numPages * perPage);
+            BenchmarkProcessor                       processor;
+            juce::AudioProcessorValueTreeState       state (processor, nullptr, "state", makeLayout (ids));
+            juce::GenericAudioProcessorEditor        editor (processor);
+
+            runner.measure ("editor-open:eager", [&] {
+                std::vector<std::unique_ptr<AttachedSlider>> sliders;
+                for (const auto& id : ids)
+                    sliders.push_back (std::make_unique<AttachedSlider> (editor, *state.getParameter (id.getParamID()), nullptr, Always));
+                doNotOptimise (sliders);
+            }, 0.001);
+
+            runner.measure ("editor-open:lazy", [&] {
+                juce::Component                               root;
+                std::array<juce::Component, numPages>         pages;
+                LazyControlRegistry                           controls;
+                for (int p = 0; p < numPages; ++p)
+                    root.addChildComponent (pages[static_cast<std::size_t> (p)]);
+                pages[0].setVisible (true);
+
+                for (int i = 0; i < numPages * perPage; ++i) {
+                    auto& param = *state.getParameter (ids[static_cast<std::size_t> (i)].getParamID());
+                    controls.add<AttachedSlider> (pages[static_cast<std::size_t> (i / perPage)], editor, param, nullptr, Always);
+                }
+                doNotOptimise (controls);
+            }, 0.001);
+        }
+
+        // Resizing an editor of 500 sliders in 10 sections of 50, as during a window drag back and forth over
+        // 24 sizes: a fresh juce::Grid per resize, then CachedGridLayout with and without its cache
+        void measureResize (Runner& runner) {
+            constexpr int numSections = 10, perSection = 50, numSizes = 24;
+
+            const auto                               ids = makeParameterIDs (numSections * perSection);
+            BenchmarkProcessor                       processor;
+            juce::AudioProcessorValueTreeState       state (processor, nullptr, "state", makeLayout (ids));
+            juce::GenericAudioProcessorEditor        editor (processor);
+
+            std::vector<std::unique_ptr<AttachedSlider>> sliders;
+            for (const auto& id : ids)
+                sliders.push_back (std::make_unique<AttachedSlider> (editor, *state.getParameter (id.getParamID()), nullptr, Always));
+
+            int        frame    = 0;
+            const auto nextSize = [&frame] {
+                const auto step = frame++ % (2 * numSizes);
+                const auto i    = step < numSizes ? step : 2 * numSizes - 1 - step;
+                return juce::Rectangle<int> (0, 0, 800 + i * 10, 600 + i * 5);
+            };
+
+            runner.measure ("resize:500:juce-grid", [&] {
+                const auto bounds = nextSize();
+                juce::Grid outer;
+                outer.templateRows.add (Fr (1));
+                for (int s = 0; s < numSections; ++s)
+                    outer.templateColumns.add (Fr (1));
+                for (int s = 0; s < numSections; ++s)
+                    outer.items.add (juce::GridItem());
+                outer.performLayout (bounds);
+
+                for (int s = 0; s < numSections; ++s) {
+                    juce::Grid section;
+                    section.templateColumns = { Fr (1) };
+                    section.autoRows        = juce::Grid::TrackInfo (Fr (1));
+                    for (int i = 0; i < perSection; ++i)
+                        section.items.add (juce::GridItem (*sliders[static_cast<std::size_t> (s * perSection + i)]));
+                    section.performLayout (outer.items.getReference (s).currentBounds.toNearestIntEdges());
+                }
+            }, 0.005);
+
+            CachedGridLayout                          root;
+            std::array<CachedGridLayout, numSections> sections;
+            root.getGrid().templateRows = { Fr (1) };
+            root.setTrackSource (CachedGridLayout::TrackSource::columnsFromItems);
+            for (int s = 0; s < numSections; ++s) {
+                auto& section                     = sections[static_cast<std::size_t> (s)];
+                section.getGrid().templateColumns = { Fr (1) };
+                section.getGrid().autoRows        = juce::Grid::TrackInfo (Fr (1));
+                for (int i = 0; i < perSection; ++i)
+                    section.add (*sliders[static_cast<std::size_t> (s * perSection + i)]);
+                root.add (section);
+            }
+
+            runner.measure ("resize:500:cached-layout:cold", [&] {
+                root.invalidate();
+                for (auto& section : sections)
+                    section.invalidate();
+                root.performLayout (nextSize());
+            }, 0.005);
+
+            runner.measure ("resize:500:cached-layout:warm", [&] { root.performLayout (nextSize()); }, 0.05);
+
+            // One section changed, the rest laid out from their caches
+            runner.measure ("resize:500:cached-layout:one-dirty-section", [&] {
+                sections[0].invalidate();
+                root.performLayout (nextSize());
+            }, 0.05);
+        }
+
+        void run (Runner& runner) {
+            measureFilmstripPaint (runner);
+            measureEditorOpen (runner);
+            measureResize (runner);
+
+            const auto                               ids = makeParameterIDs (numSliders);
+            BenchmarkProcessor                       processor;
+            juce::AudioProcessorValueTreeState       state (processor, nullptr, "state", makeLayout (ids));
+            juce::GenericAudioProcessorEditor        editor (processor);
+            std::vector<juce::RangedAudioParameter*> parameters;
+            for (const auto& id : ids)
+                parameters.push_back (state.getParameter (id.getParamID()));
+
+            measureSuffixUpdates (runner, "suffix:strategy:offAtMin", [&] (juce::RangedAudioParameter& p) {
+                return std::make_unique<AttachedSlider> (editor, p, nullptr, SuffixStrategies::offAtMin (p, "Hz"));
+            }, parameters);
+
+            measureSuffixUpdates (runner, "suffix:policy:offAtMin", [&] (juce::RangedAudioParameter& p) {
+                return std::make_unique<AttachedSlider> (editor, p, nullptr, SuffixPolicies::offAtMin (p, "Hz"));
+            }, parameters);
+
+            measureSuffixUpdates (runner, "suffix:legacy:OffOnMinimum", [&] (juce::RangedAudioParameter& p) {
+                return std::make_unique<AttachedSlider> (editor, p, nullptr, OffOnMinimum);
+            }, parameters);
+        }
+
+        const Registration registration { run };
+    }
+}
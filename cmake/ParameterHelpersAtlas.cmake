@@ -0,0 +1,71 @@
+# parameter_helpers_add_filmstrip_atlas(<target>
+#         NAME <identifier>
+#         [NAMESPACE <namespace>]
+#         [PADDING <pixels>]
+#         STRIPS <strip> <image> <tileWidth> <tileHeight> <numFrames>
+#                [<strip> <image> <tileWidth> <tileHeight> <numFrames> ...])
+#
+# Packs the filmstrips into one atlas when <target> is built and generates <NAME>.h, which <target> can include.
+# The header holds the atlas PNG and a constexpr moiraesoftware::AtlasTable in namespace [<namespace>::]<NAME>:
+#
+#   #include <KnobAtlas.h>
+#   AttachedFilmstripSlider knob (editor, param, undoManager,
+#                                 FilmstripSpec::fromAtlas (KnobAtlas::table, KnobAtlas::Strip::bigKnob));
+#
+# numFrames 0 takes every tile in the image. Relative image paths are relative to the calling CMakeLists.txt.
+
+set(PARAMETER_HELPERS_DIR "${CMAKE_CURRENT_LIST_DIR}/.." CACHE INTERNAL "")
+
+function(parameter_helpers_add_filmstrip_atlas target)
+    cmake_parse_arguments(ATLAS "" "NAME;NAMESPACE;PADDING" "STRIPS" ${ARGN})
+
+    if (NOT ATLAS_NAME)
+        message(FATAL_ERROR "parameter_helpers_add_filmstrip_atlas: NAME is required")
+    endif ()
+
+    list(LENGTH ATLAS_STRIPS numValues)
+    math(EXPR remainder "${numValues} % 5")
+    if (numValues EQUAL 0 OR NOT remainder EQUAL 0)
+        message(FATAL_ERROR "parameter_helpers_add_filmstrip_atlas: STRIPS takes groups of <strip> <image> <tileWidth> <tileHeight> <numFrames>")
+    endif ()
+
+    if (NOT TARGET ParameterHelpersAtlasPacker)
+        add_subdirectory("${PARAMETER_HELPERS_DIR}/tools/AtlasPacker" "${CMAKE_BINARY_DIR}/parameter_helpers_atlas_packer")
+    endif ()
+
+    set(packerArgs)
+    set(images)
+    math(EXPR lastStrip "${numValues} / 5 - 1")
+    foreach (strip RANGE ${lastStrip})
+        math(EXPR first "${strip} * 5")
+        math(EXPR second "${first} + 1")
+        list(GET ATLAS_STRIPS ${first} stripName)
+        list(GET ATLAS_STRIPS ${second} image)
+        math(EXPR third "${first} + 2")
+        list(SUBLIST ATLAS_STRIPS ${third} 3 dimensions)
+
+        get_filename_component(image "${image}" ABSOLUTE BASE_DIR "${CMAKE_CURRENT_SOURCE_DIR}")
+        list(APPEND images "${image}")
+        list(APPEND packerArgs "${stripName}" "${image}" ${dimensions})
+    endforeach ()
+
+    set(optionalArgs)
+    if (ATLAS_NAMESPACE)
+        list(APPEND optionalArgs --namespace "${ATLAS_NAMESPACE}")
+    endif ()
+    if (DEFINED ATLAS_PADDING)
+        list(APPEND optionalArgs --padding "${ATLAS_PADDING}")
+    endif ()
+
+    set(outputDir "${CMAKE_CURRENT_BINARY_DIR}/parameter_helpers_atlases/${target}")
+    set(header "${outputDir}/${ATLAS_NAME}.h")
+
+    add_custom_command(OUTPUT "${header}"
+            COMMAND ParameterHelpersAtlasPacker --output "${header}" --name "${ATLAS_NAME}" ${optionalArgs} ${packerArgs}
+            DEPENDS ParameterHelpersAtlasPacker ${images}
+            COMMENT "Packing filmstrip atlas ${ATLAS_NAME}"
+            VERBATIM)
+
+    target_sources(${target} PRIVATE "${header}")
+    target_include_directories(${target} PRIVATE "${outputDir}")
+endfunction()
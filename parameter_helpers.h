@@ -13,6 +13,27 @@ minimumCppStandard: 17
 END_JUCE_MODULE_DECLARATION
 */
 #pragma once
+#include "ValueParser.h"
+#include "ValueText.h"
 #include "ParameterReferences.h"
+#include "ParameterTable.h"
+#include "SharedParameterResources.h"
+#include "ParameterRegistry.h"
+#include "ParameterHandleCache.h"
+#include "TripleBuffer.h"
+#include "PresetMorpher.h"
+#include "ModulationMatrix.h"
+#include "ParameterInstrumentation.h"
 #include "ParameterListener.h"
-#include "UIHelpers.h"
\ No newline at end of file
+#include "ParameterEventQueue.h"
+#include "BlockSplitter.h"
+#include "ParameterRouter.h"
+#include "ParameterChangePoller.h"
+#include "StateSnapshot.h"
+#include "ParameterUpdateDispatcher.h"
+#include "GestureCoalescer.h"
+#include "UIHelpers.h"
+#include "FilmstripAtlas.h"
+#include "Filmstrip.h"
+#include "LazyControls.h"
+#include "GridLayout.h"
\ No newline at end of file
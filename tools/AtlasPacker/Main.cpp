@@ -0,0 +1,202 @@
+// Packs filmstrip mosaics into one atlas image and writes a header holding the atlas as PNG bytes plus a
+// constexpr table of where every frame ended up, for moiraesoftware::AtlasTable.
+//
+//   ParameterHelpersAtlasPacker --output <header> --name <identifier> [--namespace <ns>] [--padding <px>]
+//                               <strip> <image> <tileWidth> <tileHeight> <numFrames> ...
+//
+// numFrames 0 takes every tile in the image. Normally run through parameter_helpers_add_filmstrip_atlas().
+
+#include <juce_core/juce_core.h>
+#include <juce_graphics/juce_graphics.h>
+
+#include <cmath>
+#include <numeric>
+
+namespace {
+    struct Strip {
+        juce::String name;
+        juce::Image  image;
+        int          tileWidth  = 0;
+        int          tileHeight = 0;
+        int          numFrames  = 0;
+        int          firstFrame = 0;
+    };
+
+    struct Placement {
+        int strip = 0, frame = 0;
+        juce::Rectangle<int> source, destination;
+    };
+
+    int fail (const juce::String& message) {
+        std::fprintf (stderr, "ParameterHelpersAtlasPacker: %s\n", message.toRawUTF8());
+        return 1;
+    }
+
+    bool isIdentifier (const juce::String& text) {
+        return text.isNotEmpty() && !juce::CharacterFunctions::isDigit (text[0])
+               && text.containsOnly ("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_");
+    }
+
+    // Shelf packing: tallest strips first, frames left to right, a new shelf when the row is full. Frames of a strip
+    // share a size, so this stays tight without a general rectangle packer.
+    int packShelves (std::vector<Strip>& strips, std::vector<Placement>& placements, int padding, int& atlasHeight) {
+        std::int64_t area = 0;
+        int widest = 0;
+        for (const auto& s : strips) {
+            area += static_cast<std::int64_t> (s.tileWidth + padding) * (s.tileHeight + padding) * s.numFrames;
+            widest = std::max (widest, s.tileWidth + padding);
+        }
+
+        auto atlasWidth = juce::nextPowerOfTwo (std::max (widest, static_cast<int> (std::ceil (std::sqrt (static_cast<double> (area))))));
+
+        std::vector<int> order (strips.size());
+        std::iota (order.begin(), order.end(), 0);
+        std::stable_sort (order.begin(), order.end(), [&] (int a, int b) { return strips[static_cast<size_t> (a)].tileHeight > strips[static_cast<size_t> (b)].tileHeight; });
+
+        int x = 0, y = 0, shelfHeight = 0;
+        for (const auto index : order) {
+            const auto& s = strips[static_cast<size_t> (index)];
+            const auto  columns = s.image.getWidth() / s.tileWidth;
+
+            for (int frame = 0; frame < s.numFrames; ++frame) {
+                if (x + s.tileWidth > atlasWidth) {
+                    x = 0;
+                    y += shelfHeight + padding;
+                    shelfHeight = 0;
+                }
+
+                placements[static_cast<size_t> (s.firstFrame + frame)] = {
+                    index, frame,
+                    { (frame % columns) * s.tileWidth, (frame / columns) * s.tileHeight, s.tileWidth, s.tileHeight },
+                    { x, y, s.tileWidth, s.tileHeight }
+                };
+
+                x += s.tileWidth + padding;
+                shelfHeight = std::max (shelfHeight, s.tileHeight);
+            }
+        }
+
+        atlasHeight = y + shelfHeight;
+        return atlasWidth;
+    }
+
+    juce::String writeBytes (const juce::MemoryBlock& data) {
+        juce::String text;
+        text.preallocateBytes (data.getSize() * 5);
+        const auto* bytes = static_cast<const unsigned char*> (data.getData());
+        for (size_t i = 0; i < data.getSize(); ++i) {
+            text << (i % 20 == 0 ? "\n        " : "") << static_cast<int> (bytes[i]) << ",";
+        }
+        return text;
+    }
+}
+
+int main (int argc, char* argv[]) {
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::File         output;
+    juce::String       name, nameSpace;
+    int                padding = 2;
+    std::vector<Strip> strips;
+
+    juce::StringArray args;
+    for (int i = 1; i < argc; ++i)
+        args.add (juce::String::fromUTF8 (argv[i]));
+
+    for (int i = 0; i < args.size(); ++i) {
+        if (args[i] == "--output" && i + 1 < args.size())
+            output = juce::File::getCurrentWorkingDirectory().getChildFile (args[++i]);
+        else if (args[i] == "--name" && i + 1 < args.size())
+            name = args[++i];
+        else if (args[i] == "--namespace" && i + 1 < args.size())
+            nameSpace = args[++i];
+        else if (args[i] == "--padding" && i + 1 < args.size())
+            padding = std::max (0, args[++i].getIntValue());
+        else if (i + 4 < args.size()) {
+            Strip s;
+            s.name       = args[i];
+            const auto file = juce::File::getCurrentWorkingDirectory().getChildFile (args[i + 1]);
+            s.image      = juce::ImageFileFormat::loadFrom (file);
+            s.tileWidth  = args[i + 2].getIntValue();
+            s.tileHeight = args[i + 3].getIntValue();
+            s.numFrames  = args[i + 4].getIntValue();
+            i += 4;
+
+            if (!isIdentifier (s.name))
+                return fail ("strip name '" + s.name + "' is not a C++ identifier");
+            if (!s.image.isValid())
+                return fail ("could not load " + file.getFullPathName());
+            if (s.tileWidth <= 0 || s.tileHeight <= 0 || s.image.getWidth() < s.tileWidth || s.image.getHeight() < s.tileHeight)
+                return fail ("bad tile size for " + s.name);
+
+            const auto tiles = (s.image.getWidth() / s.tileWidth) * (s.image.getHeight() / s.tileHeight);
+            s.numFrames = s.numFrames > 0 ? std::min (s.numFrames, tiles) : tiles;
+            strips.push_back (std::move (s));
+        } else {
+            return fail ("unexpected argument " + args[i]);
+        }
+    }
+
+    if (output == juce::File() || !isIdentifier (name) || strips.empty())
+        return fail ("usage: --output <header> --name <identifier> [--namespace <ns>] [--padding <px>] "
+                     "<strip> <image> <tileWidth> <tileHeight> <numFrames> ...");
+
+    int totalFrames = 0;
+    for (auto& s : strips) {
+        s.firstFrame = totalFrames;
+        totalFrames += s.numFrames;
+    }
+
+    std::vector<Placement> placements (static_cast<size_t> (totalFrames));
+    int        atlasHeight = 0;
+    const auto atlasWidth  = packShelves (strips, placements, padding, atlasHeight);
+
+    juce::Image atlas (juce::Image::ARGB, atlasWidth, atlasHeight, true);
+    {
+        juce::Graphics g (atlas);
+        for (const auto& p : placements) {
+            const juce::Graphics::ScopedSaveState state (g);
+            g.reduceClipRegion (p.destination);
+            g.drawImageAt (strips[static_cast<size_t> (p.strip)].image, p.destination.getX() - p.source.getX(), p.destination.getY() - p.source.getY());
+        }
+    }
+
+    juce::MemoryOutputStream png;
+    if (!juce::PNGImageFormat().writeImageToStream (atlas, png))
+        return fail ("could not encode the atlas");
+
+    juce::String header;
+    header << "// Generated by ParameterHelpersAtlasPacker from " << strips.size() << " filmstrips, do not edit\n"
+           << "#pragma once\n\n"
+           << "#include <parameter_helpers/parameter_helpers.h>\n\n"
+           << "namespace " << (nameSpace.isEmpty() ? juce::String() : nameSpace + "::") << name << " {\n"
+           << "    // " << atlasWidth << "x" << atlasHeight << " atlas\n"
+           << "    inline constexpr unsigned char png[] = {" << writeBytes (png.getMemoryBlock()) << "\n    };\n\n"
+           << "    inline constexpr moiraesoftware::AtlasFrame frames[] = {\n";
+
+    for (const auto& p : placements)
+        header << "        { " << p.destination.getX() << ", " << p.destination.getY() << ", "
+               << p.destination.getWidth() << ", " << p.destination.getHeight() << " },\n";
+
+    header << "    };\n\n"
+           << "    inline constexpr moiraesoftware::AtlasStrip strips[] = {\n";
+
+    for (const auto& s : strips)
+        header << "        { \"" << s.name << "\", " << s.firstFrame << ", " << s.numFrames << ", "
+               << s.tileWidth << ", " << s.tileHeight << " },\n";
+
+    header << "    };\n\n"
+           << "    enum class Strip : int {\n";
+
+    for (size_t i = 0; i < strips.size(); ++i)
+        header << "        " << strips[i].name << " = " << static_cast<int> (i) << ",\n";
+
+    header << "    };\n\n"
+           << "    inline constexpr moiraesoftware::AtlasTable table { png, sizeof (png), strips, std::size (strips), frames, std::size (frames) };\n"
+           << "}\n";
+
+    if (!output.getParentDirectory().createDirectory() || !output.replaceWithText (header, false, false, "\n"))
+        return fail ("could not write " + output.getFullPathName());
+
+    return 0;
+}